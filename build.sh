@@ -0,0 +1,53 @@
+#!/usr/bin/env bash
+#
+#  @file build.sh
+#  @copyright Paul Hodgson @ Unification Foundation
+#
+#  Builds <contract>.wasm and <contract>.wast for each contract with eosiocpp.
+#  ABIs are maintained in the repo and are not regenerated.
+#
+#  ./build.sh [-s] [contract ...]
+#
+#    -s  build with action stats enabled (UNIF_STATS=1, see common/unification_stats.hpp)
+#
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+
+STATS=0
+while getopts "sh" opt; do
+    case "${opt}" in
+        s) STATS=1 ;;
+        *) echo "Usage: $0 [-s] [eosio.token|unification_mother|unification_uapp ...]" >&2; exit 1 ;;
+    esac
+done
+shift $(( OPTIND - 1 ))
+
+command -v eosiocpp >/dev/null || { echo "eosiocpp not found in PATH" >&2; exit 1; }
+
+contracts=("$@")
+if [[ ${#contracts[@]} -eq 0 ]]; then
+    contracts=(eosio.token unification_mother unification_uapp)
+fi
+
+for contract in "${contracts[@]}"; do
+    dir="${ROOT}/${contract}"
+    [[ -f "${dir}/${contract}.cpp" ]] || { echo "unknown contract ${contract}" >&2; exit 1; }
+
+    src="${contract}.cpp"
+    if [[ "${STATS}" -eq 1 ]]; then
+        # eosiocpp has no option for passing defines, so wrap the source
+        src="${contract}.stats.cpp"
+        printf '#define UNIF_STATS 1\n#include "%s.cpp"\n' "${contract}" > "${dir}/${src}"
+        trap 'rm -f "${dir}/${src}"' EXIT
+    fi
+
+    echo "Building ${contract}$([[ "${STATS}" -eq 1 ]] && echo " (stats enabled)")"
+    (cd "${dir}" && eosiocpp -o "${contract}.wast" "${src}")
+
+    if [[ "${STATS}" -eq 1 ]]; then
+        rm -f "${dir}/${src}"
+        trap - EXIT
+    fi
+done
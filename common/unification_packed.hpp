@@ -0,0 +1,98 @@
+/**
+ *  @file unification_packed.hpp
+ *  @copyright Paul Hodgson @ Unification Foundation
+ */
+#pragma once
+
+#include <eosiolib/eosio.hpp>
+#include <eosiolib/varint.hpp>
+
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/tuple/elem.hpp>
+
+#include <limits>
+
+namespace UnificationFoundation {
+    using namespace eosio;
+
+/**
+ *  @defgroup unification_packed Packed Rows
+ *  @brief Helpers for table rows with a smaller serialized format
+ *
+ *  @details
+ *  UNIF_PACKED_SERIALIZE works like EOSLIB_SERIALIZE, but each field in the
+ *  list names the codec used to write and read it, so both stream operators
+ *  are generated from a single field list.
+ */
+
+    /**
+     *  Width bits at offset Shift within a packed uint8_t flags field.
+     *  Offsets are compile time constants, so get/set reduce to a mask and shift.
+     */
+    template<uint8_t Shift, uint8_t Width>
+    struct bitfield8 {
+        static_assert(Width > 0 && Shift + Width <= 8, "bitfield8 must fit in uint8_t");
+
+        static constexpr uint8_t mask = static_cast<uint8_t>(((1u << Width) - 1) << Shift);
+
+        static constexpr uint8_t get(uint8_t flags) {
+            return static_cast<uint8_t>((flags & mask) >> Shift);
+        }
+
+        static constexpr uint8_t set(uint8_t flags, uint8_t value) {
+            return static_cast<uint8_t>((flags & ~mask) | ((value << Shift) & mask));
+        }
+    };
+
+    /**
+     *  Field serialized in its normal format
+     */
+    struct as_is {
+        template<typename DataStream, typename T>
+        static void pack(DataStream& ds, const T& value) { ds << value; }
+
+        template<typename DataStream, typename T>
+        static void unpack(DataStream& ds, T& value) { ds >> value; }
+    };
+
+    /**
+     *  Integer field serialized as varuint32 (1 - 5 bytes). Values that don't
+     *  fit in 32 bits are rejected when written.
+     */
+    struct as_varuint32 {
+        template<typename DataStream, typename T>
+        static void pack(DataStream& ds, const T& value) {
+            eosio_assert(value <= std::numeric_limits<uint32_t>::max(), "value exceeds varuint32");
+            ds << unsigned_int(static_cast<uint32_t>(value));
+        }
+
+        template<typename DataStream, typename T>
+        static void unpack(DataStream& ds, T& value) {
+            unsigned_int packed;
+            ds >> packed;
+            value = packed.value;
+        }
+    };
+}
+
+#define UNIF_PACKED_PACK_FIELD(r, OBJ, FIELD) \
+    BOOST_PP_TUPLE_ELEM(2, 1, FIELD)::pack(ds, OBJ.BOOST_PP_TUPLE_ELEM(2, 0, FIELD));
+
+#define UNIF_PACKED_UNPACK_FIELD(r, OBJ, FIELD) \
+    BOOST_PP_TUPLE_ELEM(2, 1, FIELD)::unpack(ds, OBJ.BOOST_PP_TUPLE_ELEM(2, 0, FIELD));
+
+/**
+ *  Defines operator << and >> for TYPE from FIELDS, a sequence of
+ *  (member, codec) pairs, e.g. ((pkey, as_varuint32))((schema, as_is))
+ */
+#define UNIF_PACKED_SERIALIZE(TYPE, FIELDS) \
+    template<typename DataStream> \
+    friend DataStream& operator << (DataStream& ds, const TYPE& t) { \
+        BOOST_PP_SEQ_FOR_EACH(UNIF_PACKED_PACK_FIELD, t, FIELDS) \
+        return ds; \
+    } \
+    template<typename DataStream> \
+    friend DataStream& operator >> (DataStream& ds, TYPE& t) { \
+        BOOST_PP_SEQ_FOR_EACH(UNIF_PACKED_UNPACK_FIELD, t, FIELDS) \
+        return ds; \
+    }
@@ -0,0 +1,126 @@
+/**
+ *  @file unification_stats.hpp
+ *  @copyright Paul Hodgson @ Unification Foundation
+ */
+#pragma once
+
+#include <eosiolib/eosio.hpp>
+#include <eosiolib/multi_index.hpp>
+
+/**
+ *  Set UNIF_STATS to 1 (e.g. -DUNIF_STATS=1) to build a contract with per
+ *  action counters. When 0, stats_recorder is an empty type and all calls
+ *  to it compile away.
+ */
+#ifndef UNIF_STATS
+#define UNIF_STATS 0
+#endif
+
+namespace UnificationFoundation {
+
+/**
+ *  @defgroup unification_stats Action Stats
+ *  @brief Optional per action instrumentation
+ *
+ *  @details
+ *  Counters are accumulated in memory while an action runs, and written to
+ *  the contract's own actstats table (scope _self, one row per action name)
+ *  when the contract object is destroyed at the end of the action.
+ *  RAM for the table is paid by the contract account.
+ */
+
+    //@abi table actstats i64
+    struct actstats {
+        uint64_t action;
+        uint64_t calls;
+        uint64_t emplaced;
+        uint64_t modified;
+        uint64_t erased;
+        uint64_t bytes_written; //serialized size of emplaced and modified rows
+
+        uint64_t primary_key() const { return action; }
+
+        EOSLIB_SERIALIZE(actstats, (action)(calls)(emplaced)(modified)(erased)(bytes_written))
+    };
+
+    typedef eosio::multi_index<N(actstats), actstats> actstats_t;
+
+    /**
+     *  Disabled recorder. Every member is an empty inline function.
+     */
+    template<bool Enabled>
+    class action_stats {
+    public:
+        explicit action_stats(account_name) {}
+
+        void start(action_name) {}
+
+        template<typename T>
+        void emplaced(const T&) {}
+
+        template<typename T>
+        void modified(const T&) {}
+
+        void erased() {}
+    };
+
+    template<>
+    class action_stats<true> {
+    public:
+        explicit action_stats(account_name self) : _self(self) {}
+
+        ~action_stats() {
+            if (_action == 0) {
+                return;
+            }
+
+            actstats_t stats(_self, _self);
+
+            auto itr = stats.find(_action);
+            if (itr == stats.end()) {
+                stats.emplace(_self, [&](auto &s_rec) {
+                    s_rec.action = _action;
+                    s_rec.calls = 1;
+                    s_rec.emplaced = _emplaced;
+                    s_rec.modified = _modified;
+                    s_rec.erased = _erased;
+                    s_rec.bytes_written = _bytes_written;
+                });
+            } else {
+                stats.modify(itr, 0 /*payer doesn't change*/, [&](auto &s_rec) {
+                    s_rec.calls += 1;
+                    s_rec.emplaced += _emplaced;
+                    s_rec.modified += _modified;
+                    s_rec.erased += _erased;
+                    s_rec.bytes_written += _bytes_written;
+                });
+            }
+        }
+
+        void start(action_name action) { _action = action; }
+
+        template<typename T>
+        void emplaced(const T& row) {
+            _emplaced++;
+            _bytes_written += eosio::pack_size(row);
+        }
+
+        template<typename T>
+        void modified(const T& row) {
+            _modified++;
+            _bytes_written += eosio::pack_size(row);
+        }
+
+        void erased() { _erased++; }
+
+    private:
+        account_name _self;
+        action_name _action = 0;
+        uint64_t _emplaced = 0;
+        uint64_t _modified = 0;
+        uint64_t _erased = 0;
+        uint64_t _bytes_written = 0;
+    };
+
+    typedef action_stats<UNIF_STATS != 0> stats_recorder;
+}
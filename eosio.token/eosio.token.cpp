@@ -10,6 +10,7 @@ namespace eosio {
 void token::create( account_name issuer,
                     asset        maximum_supply )
 {
+    _stats.start( N(create) );
     require_auth( _self );
 
     auto sym = maximum_supply.symbol;
@@ -21,16 +22,18 @@ void token::create( account_name issuer,
     auto existing = statstable.find( sym.name() );
     eosio_assert( existing == statstable.end(), "token with symbol already exists" );
 
-    statstable.emplace( _self, [&]( auto& s ) {
+    auto st = statstable.emplace( _self, [&]( auto& s ) {
        s.supply.symbol = maximum_supply.symbol;
        s.max_supply    = maximum_supply;
        s.issuer        = issuer;
     });
+    _stats.emplaced( *st );
 }
 
 
 void token::issue( account_name to, asset quantity, string memo )
 {
+    _stats.start( N(issue) );
     auto sym = quantity.symbol;
     eosio_assert( sym.is_valid(), "invalid symbol name" );
     eosio_assert( memo.size() <= 256, "memo has more than 256 bytes" );
@@ -51,6 +54,7 @@ void token::issue( account_name to, asset quantity, string memo )
     statstable.modify( st, 0, [&]( auto& s ) {
        s.supply += quantity;
     });
+    _stats.modified( st );
 
     add_balance( st.issuer, quantity, st.issuer );
 
@@ -64,6 +68,7 @@ void token::transfer( account_name from,
                       asset        quantity,
                       string       memo )
 {
+    _stats.start( N(transfer) );
     eosio_assert( from != to, "cannot transfer to self" );
     require_auth( from );
     eosio_assert( is_account( to ), "to account does not exist");
@@ -84,6 +89,77 @@ void token::transfer( account_name from,
     add_balance( to, quantity, from );
 }
 
+void token::fundshard( account_name owner,
+                       asset        quantity,
+                       uint8_t      shard )
+{
+    _stats.start( N(fundshard) );
+    require_auth( owner );
+    auto sym = quantity.symbol.name();
+    stats statstable( _self, sym );
+    const auto& st = statstable.get( sym );
+
+    eosio_assert( quantity.is_valid(), "invalid quantity" );
+    eosio_assert( quantity.amount > 0, "must fund positive quantity" );
+    eosio_assert( shard < max_shards, "shard must be 0 - 15" );
+    eosio_assert( quantity.symbol == st.supply.symbol, "symbol precision mismatch" );
+
+    sub_balance( owner, quantity );
+    add_shard_balance( owner, shard, quantity );
+}
+
+void token::shardxfer( account_name from,
+                       uint8_t      shard,
+                       account_name to,
+                       asset        quantity,
+                       string       memo )
+{
+    _stats.start( N(shardxfer) );
+    eosio_assert( from != to, "cannot transfer to self" );
+    require_auth( from );
+    eosio_assert( is_account( to ), "to account does not exist");
+    auto sym = quantity.symbol.name();
+    stats statstable( _self, sym );
+    const auto& st = statstable.get( sym );
+
+    require_recipient( from );
+    require_recipient( to );
+
+    eosio_assert( quantity.is_valid(), "invalid quantity" );
+    eosio_assert( quantity.amount > 0, "must transfer positive quantity" );
+    eosio_assert( quantity.symbol == st.supply.symbol, "symbol precision mismatch" );
+    eosio_assert( memo.size() <= 256, "memo has more than 256 bytes" );
+    eosio_assert( shard < max_shards, "shard must be 0 - 15" );
+
+
+    sub_shard_balance( from, shard, quantity );
+    add_balance( to, quantity, from );
+}
+
+void token::consolidate( account_name owner, symbol_type sym )
+{
+    _stats.start( N(consolidate) );
+    require_auth( owner );
+    eosio_assert( sym.is_valid(), "invalid symbol name" );
+
+    asset total( 0, sym );
+
+    for( uint8_t shard = 0; shard < max_shards; ++shard ) {
+       shards owner_shards( _self, shard_scope( owner, shard ) );
+       auto itr = owner_shards.find( sym.name() );
+       if( itr != owner_shards.end() ) {
+          eosio_assert( itr->balance.symbol == sym, "symbol precision mismatch" );
+          total += itr->balance;
+          owner_shards.erase( itr );
+          _stats.erased();
+       }
+    }
+
+    eosio_assert( total.amount > 0, "no shard balances found" );
+
+    add_balance( owner, total, owner );
+}
+
 void token::sub_balance( account_name owner, asset value ) {
    accounts from_acnts( _self, owner );
 
@@ -93,10 +169,12 @@ void token::sub_balance( account_name owner, asset value ) {
 
    if( from.balance.amount == value.amount ) {
       from_acnts.erase( from );
+      _stats.erased();
    } else {
       from_acnts.modify( from, owner, [&]( auto& a ) {
           a.balance -= value;
       });
+      _stats.modified( from );
    }
 }
 
@@ -105,16 +183,53 @@ void token::add_balance( account_name owner, asset value, account_name ram_payer
    accounts to_acnts( _self, owner );
    auto to = to_acnts.find( value.symbol.name() );
    if( to == to_acnts.end() ) {
-      to_acnts.emplace( ram_payer, [&]( auto& a ){
+      auto added = to_acnts.emplace( ram_payer, [&]( auto& a ){
         a.balance = value;
       });
+      _stats.emplaced( *added );
    } else {
       to_acnts.modify( to, 0, [&]( auto& a ) {
         a.balance += value;
       });
+      _stats.modified( *to );
+   }
+}
+
+void token::sub_shard_balance( account_name owner, uint8_t shard, asset value ) {
+   shards from_shards( _self, shard_scope( owner, shard ) );
+
+   const auto& from = from_shards.get( value.symbol.name(), "no shard balance object found" );
+   eosio_assert( from.balance.amount >= value.amount, "overdrawn shard balance" );
+
+
+   if( from.balance.amount == value.amount ) {
+      from_shards.erase( from );
+      _stats.erased();
+   } else {
+      from_shards.modify( from, owner, [&]( auto& a ) {
+          a.balance -= value;
+      });
+      _stats.modified( from );
+   }
+}
+
+void token::add_shard_balance( account_name owner, uint8_t shard, asset value )
+{
+   shards to_shards( _self, shard_scope( owner, shard ) );
+   auto to = to_shards.find( value.symbol.name() );
+   if( to == to_shards.end() ) {
+      auto added = to_shards.emplace( owner, [&]( auto& a ){
+        a.balance = value;
+      });
+      _stats.emplaced( *added );
+   } else {
+      to_shards.modify( to, 0, [&]( auto& a ) {
+        a.balance += value;
+      });
+      _stats.modified( *to );
    }
 }
 
 } /// namespace eosio
 
-EOSIO_ABI( eosio::token, (create)(issue)(transfer) )
+EOSIO_ABI( eosio::token, (create)(issue)(transfer)(fundshard)(shardxfer)(consolidate) )
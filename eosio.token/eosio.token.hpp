@@ -9,6 +9,8 @@
 
 #include <string>
 
+#include "../common/unification_stats.hpp"
+
 namespace eosiosystem {
    class system_contract;
 }
@@ -19,7 +21,7 @@ namespace eosio {
 
    class token : public contract {
       public:
-         token( account_name self ):contract(self){}
+         token( account_name self ):contract(self),_stats(self){}
 
          void create( account_name issuer,
                       asset        maximum_supply);
@@ -30,6 +32,18 @@ namespace eosio {
                         account_name to,
                         asset        quantity,
                         string       memo );
+
+         void fundshard( account_name owner,
+                         asset        quantity,
+                         uint8_t      shard );
+
+         void shardxfer( account_name from,
+                         uint8_t      shard,
+                         account_name to,
+                         asset        quantity,
+                         string       memo );
+
+         void consolidate( account_name owner, symbol_type sym );
       
       
          inline asset get_supply( symbol_name sym )const;
@@ -37,6 +51,8 @@ namespace eosio {
          inline asset get_balance( account_name owner, symbol_name sym )const;
 
       private:
+         UnificationFoundation::stats_recorder _stats;
+
          struct account {
             asset    balance;
 
@@ -53,9 +69,24 @@ namespace eosio {
 
          typedef eosio::multi_index<N(accounts), account> accounts;
          typedef eosio::multi_index<N(stat), currency_stats> stats;
+         /**
+          * Part of an owner's balance set aside in one of max_shards shards, so
+          * high volume payouts from one account don't all modify the same
+          * accounts row. Each shard is its own scope: account names are at most
+          * 12 characters, leaving the low 4 bits of the name free for the shard.
+          */
+         typedef eosio::multi_index<N(shards), account> shards;
+
+         static constexpr uint8_t max_shards = 16;
+
+         static uint64_t shard_scope( account_name owner, uint8_t shard ) {
+            return owner | shard;
+         }
 
          void sub_balance( account_name owner, asset value );
          void add_balance( account_name owner, asset value, account_name ram_payer );
+         void sub_shard_balance( account_name owner, uint8_t shard, asset value );
+         void add_shard_balance( account_name owner, uint8_t shard, asset value );
 
       public:
          struct transfer_args {
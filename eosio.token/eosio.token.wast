@@ -1,12251 +0,0 @@
-(module
- (type $FUNCSIG$viji (func (param i32 i64 i32)))
- (type $FUNCSIG$vijjii (func (param i32 i64 i64 i32 i32)))
- (type $FUNCSIG$vijii (func (param i32 i64 i32 i32)))
- (type $FUNCSIG$v (func))
- (type $FUNCSIG$j (func (result i64)))
- (type $FUNCSIG$vjj (func (param i64 i64)))
- (type $FUNCSIG$vj (func (param i64)))
- (type $FUNCSIG$vii (func (param i32 i32)))
- (type $FUNCSIG$ijjjj (func (param i64 i64 i64 i64) (result i32)))
- (type $FUNCSIG$ijjjjii (func (param i64 i64 i64 i64 i32 i32) (result i32)))
- (type $FUNCSIG$iiii (func (param i32 i32 i32) (result i32)))
- (type $FUNCSIG$ij (func (param i64) (result i32)))
- (type $FUNCSIG$vi (func (param i32)))
- (type $FUNCSIG$i (func (result i32)))
- (type $FUNCSIG$iii (func (param i32 i32) (result i32)))
- (import "env" "abort" (func $abort))
- (import "env" "action_data_size" (func $action_data_size (result i32)))
- (import "env" "current_receiver" (func $current_receiver (result i64)))
- (import "env" "current_time" (func $current_time (result i64)))
- (import "env" "db_find_i64" (func $db_find_i64 (param i64 i64 i64 i64) (result i32)))
- (import "env" "db_get_i64" (func $db_get_i64 (param i32 i32 i32) (result i32)))
- (import "env" "db_remove_i64" (func $db_remove_i64 (param i32)))
- (import "env" "db_store_i64" (func $db_store_i64 (param i64 i64 i64 i64 i32 i32) (result i32)))
- (import "env" "db_update_i64" (func $db_update_i64 (param i32 i64 i32 i32)))
- (import "env" "eosio_assert" (func $eosio_assert (param i32 i32)))
- (import "env" "is_account" (func $is_account (param i64) (result i32)))
- (import "env" "memcpy" (func $memcpy (param i32 i32 i32) (result i32)))
- (import "env" "read_action_data" (func $read_action_data (param i32 i32) (result i32)))
- (import "env" "require_auth" (func $require_auth (param i64)))
- (import "env" "require_auth2" (func $require_auth2 (param i64 i64)))
- (import "env" "require_recipient" (func $require_recipient (param i64)))
- (import "env" "send_inline" (func $send_inline (param i32 i32)))
- (table 4 4 anyfunc)
- (elem (i32.const 0) $__wasm_nullptr $_ZN5eosio5token6createEyNS_5assetE $_ZN5eosio5token8transferEyyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE $_ZN5eosio5token5issueEyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE)
- (memory $0 1)
- (data (i32.const 4) "Pg\00\00")
- (data (i32.const 16) "invalid symbol name\00")
- (data (i32.const 48) "invalid supply\00")
- (data (i32.const 64) "max-supply must be positive\00")
- (data (i32.const 96) "object passed to iterator_to is not in multi_index\00")
- (data (i32.const 160) "token with symbol already exists\00")
- (data (i32.const 208) "cannot create objects in table of another contract\00")
- (data (i32.const 272) "write\00")
- (data (i32.const 288) "magnitude of asset amount must be less than 2^62\00")
- (data (i32.const 352) "error reading iterator\00")
- (data (i32.const 384) "read\00")
- (data (i32.const 400) "memo has more than 256 bytes\00")
- (data (i32.const 432) "token with symbol does not exist, create token before issue\00")
- (data (i32.const 496) "invalid quantity\00")
- (data (i32.const 528) "must issue positive quantity\00")
- (data (i32.const 560) "symbol precision mismatch\00")
- (data (i32.const 592) "quantity exceeds available supply\00")
- (data (i32.const 640) "object passed to modify is not in multi_index\00")
- (data (i32.const 688) "cannot modify objects in table of another contract\00")
- (data (i32.const 752) "attempt to add asset with different symbol\00")
- (data (i32.const 800) "addition underflow\00")
- (data (i32.const 832) "addition overflow\00")
- (data (i32.const 864) "updater cannot change primary key when modifying an object\00")
- (data (i32.const 928) "active\00")
- (data (i32.const 944) "cannot pass end iterator to modify\00")
- (data (i32.const 992) "cannot transfer to self\00")
- (data (i32.const 1024) "to account does not exist\00")
- (data (i32.const 1056) "unable to find key\00")
- (data (i32.const 1088) "must transfer positive quantity\00")
- (data (i32.const 1120) "no balance object found\00")
- (data (i32.const 1152) "overdrawn balance\00")
- (data (i32.const 1184) "attempt to subtract asset with different symbol\00")
- (data (i32.const 1232) "subtraction underflow\00")
- (data (i32.const 1264) "subtraction overflow\00")
- (data (i32.const 1296) "object passed to erase is not in multi_index\00")
- (data (i32.const 1344) "cannot erase objects in table of another contract\00")
- (data (i32.const 1408) "attempt to remove object that was not in multi_index\00")
- (data (i32.const 1472) "onerror\00")
- (data (i32.const 1488) "eosio\00")
- (data (i32.const 1504) "onerror action\'s are only valid from the \"eosio\" system account\00")
- (data (i32.const 1568) "get\00")
- (data (i32.const 9968) "malloc_from_freed was designed to only be called after _heap was completely allocated\00")
- (export "memory" (memory $0))
- (export "_ZeqRK11checksum256S1_" (func $_ZeqRK11checksum256S1_))
- (export "_ZeqRK11checksum160S1_" (func $_ZeqRK11checksum160S1_))
- (export "_ZneRK11checksum160S1_" (func $_ZneRK11checksum160S1_))
- (export "now" (func $now))
- (export "_ZN5eosio12require_authERKNS_16permission_levelE" (func $_ZN5eosio12require_authERKNS_16permission_levelE))
- (export "_ZN5eosio5token6createEyNS_5assetE" (func $_ZN5eosio5token6createEyNS_5assetE))
- (export "_ZN5eosio5token5issueEyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE" (func $_ZN5eosio5token5issueEyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE))
- (export "_ZN5eosio5token11add_balanceEyNS_5assetEy" (func $_ZN5eosio5token11add_balanceEyNS_5assetEy))
- (export "_ZN5eosio5token8transferEyyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE" (func $_ZN5eosio5token8transferEyyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE))
- (export "_ZN5eosio5token11sub_balanceEyNS_5assetE" (func $_ZN5eosio5token11sub_balanceEyNS_5assetE))
- (export "apply" (func $apply))
- (export "malloc" (func $malloc))
- (export "free" (func $free))
- (export "memcmp" (func $memcmp))
- (func $_ZeqRK11checksum256S1_ (param $0 i32) (param $1 i32) (result i32)
-  (i32.eqz
-   (call $memcmp
-    (get_local $0)
-    (get_local $1)
-    (i32.const 32)
-   )
-  )
- )
- (func $_ZeqRK11checksum160S1_ (param $0 i32) (param $1 i32) (result i32)
-  (i32.eqz
-   (call $memcmp
-    (get_local $0)
-    (get_local $1)
-    (i32.const 32)
-   )
-  )
- )
- (func $_ZneRK11checksum160S1_ (param $0 i32) (param $1 i32) (result i32)
-  (i32.ne
-   (call $memcmp
-    (get_local $0)
-    (get_local $1)
-    (i32.const 32)
-   )
-   (i32.const 0)
-  )
- )
- (func $now (result i32)
-  (i32.wrap/i64
-   (i64.div_u
-    (call $current_time)
-    (i64.const 1000000)
-   )
-  )
- )
- (func $_ZN5eosio12require_authERKNS_16permission_levelE (param $0 i32)
-  (call $require_auth2
-   (i64.load
-    (get_local $0)
-   )
-   (i64.load offset=8
-    (get_local $0)
-   )
-  )
- )
- (func $_ZN5eosio5token6createEyNS_5assetE (type $FUNCSIG$viji) (param $0 i32) (param $1 i64) (param $2 i32)
-  (local $3 i64)
-  (local $4 i64)
-  (local $5 i64)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (local $9 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 128)
-    )
-   )
-  )
-  (call $require_auth
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (set_local $8
-   (i32.const 0)
-  )
-  (set_local $7
-   (tee_local $4
-    (i64.shr_u
-     (tee_local $3
-      (i64.load offset=8
-       (get_local $2)
-      )
-     )
-     (i64.const 8)
-    )
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (loop $label$2
-     (br_if $label$1
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $7)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$3
-      (br_if $label$3
-       (i64.ne
-        (i64.and
-         (tee_local $7
-          (i64.shr_u
-           (get_local $7)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$4
-       (br_if $label$1
-        (i64.ne
-         (i64.and
-          (tee_local $7
-           (i64.shr_u
-            (get_local $7)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$4
-        (i32.lt_s
-         (tee_local $8
-          (i32.add
-           (get_local $8)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $6
-      (i32.const 1)
-     )
-     (br_if $label$2
-      (i32.lt_s
-       (tee_local $8
-        (i32.add
-         (get_local $8)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$0)
-    )
-   )
-   (set_local $6
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $6)
-   (i32.const 16)
-  )
-  (set_local $6
-   (i32.const 0)
-  )
-  (block $label$5
-   (br_if $label$5
-    (i64.gt_u
-     (i64.add
-      (tee_local $5
-       (i64.load
-        (get_local $2)
-       )
-      )
-      (i64.const 4611686018427387903)
-     )
-     (i64.const 9223372036854775806)
-    )
-   )
-   (set_local $8
-    (i32.const 0)
-   )
-   (set_local $7
-    (get_local $4)
-   )
-   (block $label$6
-    (loop $label$7
-     (br_if $label$6
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $7)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i64.ne
-        (i64.and
-         (tee_local $7
-          (i64.shr_u
-           (get_local $7)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$9
-       (br_if $label$6
-        (i64.ne
-         (i64.and
-          (tee_local $7
-           (i64.shr_u
-            (get_local $7)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$9
-        (i32.lt_s
-         (tee_local $8
-          (i32.add
-           (get_local $8)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $6
-      (i32.const 1)
-     )
-     (br_if $label$7
-      (i32.lt_s
-       (tee_local $8
-        (i32.add
-         (get_local $8)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$5)
-    )
-   )
-   (set_local $6
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $6)
-   (i32.const 48)
-  )
-  (call $eosio_assert
-   (i64.gt_s
-    (get_local $5)
-    (i64.const 0)
-   )
-   (i32.const 64)
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $9)
-     (i32.const 8)
-    )
-    (i32.const 32)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=24
-   (get_local $9)
-   (i64.const -1)
-  )
-  (i64.store offset=32
-   (get_local $9)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $9)
-   (tee_local $7
-    (i64.load
-     (get_local $0)
-    )
-   )
-  )
-  (i64.store offset=16
-   (get_local $9)
-   (get_local $4)
-  )
-  (block $label$10
-   (block $label$11
-    (br_if $label$11
-     (i32.lt_s
-      (tee_local $8
-       (call $db_find_i64
-        (get_local $7)
-        (get_local $4)
-        (i64.const -4157508551318700032)
-        (get_local $4)
-       )
-      )
-      (i32.const 0)
-     )
-    )
-    (call $eosio_assert
-     (i32.eq
-      (i32.load offset=40
-       (call $_ZNK5eosio11multi_indexILy14289235522390851584ENS_5token14currency_statsEJEE31load_object_by_primary_iteratorEl
-        (i32.add
-         (get_local $9)
-         (i32.const 8)
-        )
-        (get_local $8)
-       )
-      )
-      (i32.add
-       (get_local $9)
-       (i32.const 8)
-      )
-     )
-     (i32.const 96)
-    )
-    (set_local $8
-     (i32.const 0)
-    )
-    (br $label$10)
-   )
-   (set_local $8
-    (i32.const 1)
-   )
-  )
-  (call $eosio_assert
-   (get_local $8)
-   (i32.const 160)
-  )
-  (set_local $4
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i64.eq
-    (i64.load offset=8
-     (get_local $9)
-    )
-    (call $current_receiver)
-   )
-   (i32.const 208)
-  )
-  (drop
-   (call $_ZN5eosio5token14currency_statsC2Ev
-    (tee_local $8
-     (call $_Znwj
-      (i32.const 56)
-     )
-    )
-   )
-  )
-  (i32.store offset=40
-   (get_local $8)
-   (i32.add
-    (get_local $9)
-    (i32.const 8)
-   )
-  )
-  (i64.store offset=8
-   (get_local $8)
-   (get_local $3)
-  )
-  (i32.store
-   (i32.add
-    (get_local $8)
-    (i32.const 28)
-   )
-   (i32.load
-    (i32.add
-     (get_local $2)
-     (i32.const 12)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $8)
-    (i32.const 24)
-   )
-   (i32.load
-    (i32.add
-     (get_local $2)
-     (i32.const 8)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $8)
-    (i32.const 20)
-   )
-   (i32.load
-    (i32.add
-     (get_local $2)
-     (i32.const 4)
-    )
-   )
-  )
-  (i32.store offset=16
-   (get_local $8)
-   (i32.load
-    (get_local $2)
-   )
-  )
-  (i64.store offset=32
-   (get_local $8)
-   (get_local $1)
-  )
-  (i32.store offset=96
-   (get_local $9)
-   (i32.add
-    (i32.add
-     (get_local $9)
-     (i32.const 48)
-    )
-    (i32.const 40)
-   )
-  )
-  (i32.store offset=92
-   (get_local $9)
-   (i32.add
-    (get_local $9)
-    (i32.const 48)
-   )
-  )
-  (i32.store offset=88
-   (get_local $9)
-   (i32.add
-    (get_local $9)
-    (i32.const 48)
-   )
-  )
-  (i32.store offset=104
-   (get_local $9)
-   (i32.add
-    (get_local $9)
-    (i32.const 88)
-   )
-  )
-  (i32.store offset=116
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (i32.const 16)
-   )
-  )
-  (i32.store offset=112
-   (get_local $9)
-   (get_local $8)
-  )
-  (i32.store offset=120
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (i32.const 32)
-   )
-  )
-  (call $_ZN5boost3pfr6detail19for_each_field_implINS1_14sequence_tuple5tupleIJRKN5eosio5assetES8_RKyEEEZNS5_lsINS5_10datastreamIPcEENS5_5token14currency_statsELPv0EEERT_SK_RKT0_EUlRKSJ_E_JLj0ELj1ELj2EEEEvSK_OSL_NSt3__116integer_sequenceIjJXspT1_EEEENSS_17integral_constantIbLb0EEE
-   (i32.add
-    (get_local $9)
-    (i32.const 112)
-   )
-   (i32.add
-    (get_local $9)
-    (i32.const 104)
-   )
-  )
-  (i32.store offset=44
-   (get_local $8)
-   (tee_local $6
-    (call $db_store_i64
-     (i64.load
-      (i32.add
-       (i32.add
-        (get_local $9)
-        (i32.const 8)
-       )
-       (i32.const 8)
-      )
-     )
-     (i64.const -4157508551318700032)
-     (get_local $4)
-     (tee_local $7
-      (i64.shr_u
-       (i64.load offset=8
-        (get_local $8)
-       )
-       (i64.const 8)
-      )
-     )
-     (i32.add
-      (get_local $9)
-      (i32.const 48)
-     )
-     (i32.const 40)
-    )
-   )
-  )
-  (block $label$12
-   (br_if $label$12
-    (i64.lt_u
-     (get_local $7)
-     (i64.load
-      (tee_local $2
-       (i32.add
-        (i32.add
-         (get_local $9)
-         (i32.const 8)
-        )
-        (i32.const 16)
-       )
-      )
-     )
-    )
-   )
-   (i64.store
-    (get_local $2)
-    (i64.add
-     (get_local $7)
-     (i64.const 1)
-    )
-   )
-  )
-  (i32.store offset=112
-   (get_local $9)
-   (get_local $8)
-  )
-  (i64.store offset=48
-   (get_local $9)
-   (tee_local $7
-    (i64.shr_u
-     (i64.load
-      (i32.add
-       (get_local $8)
-       (i32.const 8)
-      )
-     )
-     (i64.const 8)
-    )
-   )
-  )
-  (i32.store offset=88
-   (get_local $9)
-   (get_local $6)
-  )
-  (block $label$13
-   (block $label$14
-    (br_if $label$14
-     (i32.ge_u
-      (tee_local $2
-       (i32.load
-        (i32.add
-         (i32.add
-          (get_local $9)
-          (i32.const 8)
-         )
-         (i32.const 28)
-        )
-       )
-      )
-      (i32.load
-       (i32.add
-        (get_local $9)
-        (i32.const 40)
-       )
-      )
-     )
-    )
-    (i64.store offset=8
-     (get_local $2)
-     (get_local $7)
-    )
-    (i32.store offset=16
-     (get_local $2)
-     (get_local $6)
-    )
-    (i32.store offset=112
-     (get_local $9)
-     (i32.const 0)
-    )
-    (i32.store
-     (get_local $2)
-     (get_local $8)
-    )
-    (i32.store
-     (i32.add
-      (get_local $9)
-      (i32.const 36)
-     )
-     (i32.add
-      (get_local $2)
-      (i32.const 24)
-     )
-    )
-    (br $label$13)
-   )
-   (call $_ZNSt3__16vectorIN5eosio11multi_indexILy14289235522390851584ENS1_5token14currency_statsEJEE8item_ptrENS_9allocatorIS6_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS5_4itemENS_14default_deleteISC_EEEERyRlEEEvDpOT_
-    (i32.add
-     (get_local $9)
-     (i32.const 32)
-    )
-    (i32.add
-     (get_local $9)
-     (i32.const 112)
-    )
-    (i32.add
-     (get_local $9)
-     (i32.const 48)
-    )
-    (i32.add
-     (get_local $9)
-     (i32.const 88)
-    )
-   )
-  )
-  (set_local $8
-   (i32.load offset=112
-    (get_local $9)
-   )
-  )
-  (i32.store offset=112
-   (get_local $9)
-   (i32.const 0)
-  )
-  (block $label$15
-   (br_if $label$15
-    (i32.eqz
-     (get_local $8)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $8)
-   )
-  )
-  (block $label$16
-   (br_if $label$16
-    (i32.eqz
-     (tee_local $6
-      (i32.load offset=32
-       (get_local $9)
-      )
-     )
-    )
-   )
-   (block $label$17
-    (block $label$18
-     (br_if $label$18
-      (i32.eq
-       (tee_local $8
-        (i32.load
-         (tee_local $0
-          (i32.add
-           (get_local $9)
-           (i32.const 36)
-          )
-         )
-        )
-       )
-       (get_local $6)
-      )
-     )
-     (loop $label$19
-      (set_local $2
-       (i32.load
-        (tee_local $8
-         (i32.add
-          (get_local $8)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $8)
-       (i32.const 0)
-      )
-      (block $label$20
-       (br_if $label$20
-        (i32.eqz
-         (get_local $2)
-        )
-       )
-       (call $_ZdlPv
-        (get_local $2)
-       )
-      )
-      (br_if $label$19
-       (i32.ne
-        (get_local $6)
-        (get_local $8)
-       )
-      )
-     )
-     (set_local $8
-      (i32.load
-       (i32.add
-        (get_local $9)
-        (i32.const 32)
-       )
-      )
-     )
-     (br $label$17)
-    )
-    (set_local $8
-     (get_local $6)
-    )
-   )
-   (i32.store
-    (get_local $0)
-    (get_local $6)
-   )
-   (call $_ZdlPv
-    (get_local $8)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 128)
-   )
-  )
- )
- (func $_ZNK5eosio11multi_indexILy14289235522390851584ENS_5token14currency_statsEJEE31load_object_by_primary_iteratorEl (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i64)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (set_local $8
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 48)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $9)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eq
-     (tee_local $7
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 28)
-       )
-      )
-     )
-     (tee_local $2
-      (i32.load offset=24
-       (get_local $0)
-      )
-     )
-    )
-   )
-   (set_local $3
-    (i32.sub
-     (i32.const 0)
-     (get_local $2)
-    )
-   )
-   (set_local $6
-    (i32.add
-     (get_local $7)
-     (i32.const -24)
-    )
-   )
-   (loop $label$1
-    (br_if $label$0
-     (i32.eq
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const 16)
-       )
-      )
-      (get_local $1)
-     )
-    )
-    (set_local $7
-     (get_local $6)
-    )
-    (set_local $6
-     (tee_local $4
-      (i32.add
-       (get_local $6)
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$1
-     (i32.ne
-      (i32.add
-       (get_local $4)
-       (get_local $3)
-      )
-      (i32.const -24)
-     )
-    )
-   )
-  )
-  (block $label$2
-   (block $label$3
-    (br_if $label$3
-     (i32.eq
-      (get_local $7)
-      (get_local $2)
-     )
-    )
-    (set_local $6
-     (i32.load
-      (i32.add
-       (get_local $7)
-       (i32.const -24)
-      )
-     )
-    )
-    (br $label$2)
-   )
-   (call $eosio_assert
-    (i32.xor
-     (i32.shr_u
-      (tee_local $6
-       (call $db_get_i64
-        (get_local $1)
-        (i32.const 0)
-        (i32.const 0)
-       )
-      )
-      (i32.const 31)
-     )
-     (i32.const 1)
-    )
-    (i32.const 352)
-   )
-   (block $label$4
-    (block $label$5
-     (br_if $label$5
-      (i32.lt_u
-       (get_local $6)
-       (i32.const 513)
-      )
-     )
-     (set_local $4
-      (call $malloc
-       (get_local $6)
-      )
-     )
-     (br $label$4)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $4
-      (i32.sub
-       (get_local $9)
-       (i32.and
-        (i32.add
-         (get_local $6)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $db_get_i64
-     (get_local $1)
-     (get_local $4)
-     (get_local $6)
-    )
-   )
-   (i32.store offset=12
-    (get_local $8)
-    (get_local $4)
-   )
-   (i32.store offset=8
-    (get_local $8)
-    (get_local $4)
-   )
-   (i32.store offset=16
-    (get_local $8)
-    (i32.add
-     (get_local $4)
-     (get_local $6)
-    )
-   )
-   (block $label$6
-    (br_if $label$6
-     (i32.lt_u
-      (get_local $6)
-      (i32.const 513)
-     )
-    )
-    (call $free
-     (get_local $4)
-    )
-   )
-   (drop
-    (call $_ZN5eosio5token14currency_statsC2Ev
-     (tee_local $6
-      (call $_Znwj
-       (i32.const 56)
-      )
-     )
-    )
-   )
-   (i32.store offset=40
-    (get_local $6)
-    (get_local $0)
-   )
-   (i32.store offset=24
-    (get_local $8)
-    (i32.add
-     (get_local $8)
-     (i32.const 8)
-    )
-   )
-   (i32.store offset=36
-    (get_local $8)
-    (i32.add
-     (get_local $6)
-     (i32.const 16)
-    )
-   )
-   (i32.store offset=32
-    (get_local $8)
-    (get_local $6)
-   )
-   (i32.store offset=40
-    (get_local $8)
-    (i32.add
-     (get_local $6)
-     (i32.const 32)
-    )
-   )
-   (call $_ZN5boost3pfr6detail19for_each_field_implINS1_14sequence_tuple5tupleIJRN5eosio5assetES7_RyEEEZNS5_rsINS5_10datastreamIPKcEENS5_5token14currency_statsELPv0EEERT_SJ_RT0_EUlSJ_E_JLj0ELj1ELj2EEEEvSJ_OSK_NSt3__116integer_sequenceIjJXspT1_EEEENSO_17integral_constantIbLb0EEE
-    (i32.add
-     (get_local $8)
-     (i32.const 32)
-    )
-    (i32.add
-     (get_local $8)
-     (i32.const 24)
-    )
-   )
-   (i32.store offset=44
-    (get_local $6)
-    (get_local $1)
-   )
-   (i32.store offset=24
-    (get_local $8)
-    (get_local $6)
-   )
-   (i64.store offset=32
-    (get_local $8)
-    (tee_local $5
-     (i64.shr_u
-      (i64.load offset=8
-       (get_local $6)
-      )
-      (i64.const 8)
-     )
-    )
-   )
-   (i32.store offset=4
-    (get_local $8)
-    (tee_local $7
-     (i32.load offset=44
-      (get_local $6)
-     )
-    )
-   )
-   (block $label$7
-    (block $label$8
-     (br_if $label$8
-      (i32.ge_u
-       (tee_local $4
-        (i32.load
-         (tee_local $1
-          (i32.add
-           (get_local $0)
-           (i32.const 28)
-          )
-         )
-        )
-       )
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 32)
-        )
-       )
-      )
-     )
-     (i64.store offset=8
-      (get_local $4)
-      (get_local $5)
-     )
-     (i32.store offset=16
-      (get_local $4)
-      (get_local $7)
-     )
-     (i32.store offset=24
-      (get_local $8)
-      (i32.const 0)
-     )
-     (i32.store
-      (get_local $4)
-      (get_local $6)
-     )
-     (i32.store
-      (get_local $1)
-      (i32.add
-       (get_local $4)
-       (i32.const 24)
-      )
-     )
-     (br $label$7)
-    )
-    (call $_ZNSt3__16vectorIN5eosio11multi_indexILy14289235522390851584ENS1_5token14currency_statsEJEE8item_ptrENS_9allocatorIS6_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS5_4itemENS_14default_deleteISC_EEEERyRlEEEvDpOT_
-     (i32.add
-      (get_local $0)
-      (i32.const 24)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 24)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 32)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 4)
-     )
-    )
-   )
-   (set_local $4
-    (i32.load offset=24
-     (get_local $8)
-    )
-   )
-   (i32.store offset=24
-    (get_local $8)
-    (i32.const 0)
-   )
-   (br_if $label$2
-    (i32.eqz
-     (get_local $4)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $4)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 48)
-   )
-  )
-  (get_local $6)
- )
- (func $_ZN5eosio5token14currency_statsC2Ev (param $0 i32) (result i32)
-  (local $1 i64)
-  (local $2 i32)
-  (local $3 i32)
-  (i64.store offset=8
-   (get_local $0)
-   (i64.const 1398362884)
-  )
-  (i64.store
-   (get_local $0)
-   (i64.const 0)
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 288)
-  )
-  (set_local $1
-   (i64.shr_u
-    (i64.load offset=8
-     (get_local $0)
-    )
-    (i64.const 8)
-   )
-  )
-  (set_local $2
-   (i32.const 0)
-  )
-  (block $label$0
-   (block $label$1
-    (loop $label$2
-     (br_if $label$1
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $1)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$3
-      (br_if $label$3
-       (i64.ne
-        (i64.and
-         (tee_local $1
-          (i64.shr_u
-           (get_local $1)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$4
-       (br_if $label$1
-        (i64.ne
-         (i64.and
-          (tee_local $1
-           (i64.shr_u
-            (get_local $1)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$4
-        (i32.lt_s
-         (tee_local $2
-          (i32.add
-           (get_local $2)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $3
-      (i32.const 1)
-     )
-     (br_if $label$2
-      (i32.lt_s
-       (tee_local $2
-        (i32.add
-         (get_local $2)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$0)
-    )
-   )
-   (set_local $3
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $3)
-   (i32.const 16)
-  )
-  (i64.store
-   (tee_local $2
-    (i32.add
-     (get_local $0)
-     (i32.const 24)
-    )
-   )
-   (i64.const 1398362884)
-  )
-  (i64.store offset=16
-   (get_local $0)
-   (i64.const 0)
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 288)
-  )
-  (set_local $1
-   (i64.shr_u
-    (i64.load
-     (get_local $2)
-    )
-    (i64.const 8)
-   )
-  )
-  (set_local $2
-   (i32.const 0)
-  )
-  (block $label$5
-   (block $label$6
-    (loop $label$7
-     (br_if $label$6
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $1)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i64.ne
-        (i64.and
-         (tee_local $1
-          (i64.shr_u
-           (get_local $1)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$9
-       (br_if $label$6
-        (i64.ne
-         (i64.and
-          (tee_local $1
-           (i64.shr_u
-            (get_local $1)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$9
-        (i32.lt_s
-         (tee_local $2
-          (i32.add
-           (get_local $2)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $3
-      (i32.const 1)
-     )
-     (br_if $label$7
-      (i32.lt_s
-       (tee_local $2
-        (i32.add
-         (get_local $2)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$5)
-    )
-   )
-   (set_local $3
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $3)
-   (i32.const 16)
-  )
-  (get_local $0)
- )
- (func $_ZN5boost3pfr6detail19for_each_field_implINS1_14sequence_tuple5tupleIJRKN5eosio5assetES8_RKyEEEZNS5_lsINS5_10datastreamIPcEENS5_5token14currency_statsELPv0EEERT_SK_RKT0_EUlRKSJ_E_JLj0ELj1ELj2EEEEvSK_OSL_NSt3__116integer_sequenceIjJXspT1_EEEENSS_17integral_constantIbLb0EEE (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (set_local $3
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $2)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (get_local $3)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (tee_local $4
-    (i32.add
-     (i32.load offset=4
-      (get_local $2)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (get_local $2)
-     )
-     (get_local $4)
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.add
-     (get_local $3)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (i32.add
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (set_local $3
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $2)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (get_local $3)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (tee_local $4
-    (i32.add
-     (i32.load offset=4
-      (get_local $2)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (get_local $2)
-     )
-     (get_local $4)
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.add
-     (get_local $3)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (i32.add
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (set_local $0
-   (i32.load offset=8
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $2)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (i32.add
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
- )
- (func $_ZNSt3__16vectorIN5eosio11multi_indexILy14289235522390851584ENS1_5token14currency_statsEJEE8item_ptrENS_9allocatorIS6_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS5_4itemENS_14default_deleteISC_EEEERyRlEEEvDpOT_ (param $0 i32) (param $1 i32) (param $2 i32) (param $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.ge_u
-      (tee_local $5
-       (i32.add
-        (tee_local $4
-         (i32.div_s
-          (i32.sub
-           (i32.load offset=4
-            (get_local $0)
-           )
-           (tee_local $6
-            (i32.load
-             (get_local $0)
-            )
-           )
-          )
-          (i32.const 24)
-         )
-        )
-        (i32.const 1)
-       )
-      )
-      (i32.const 178956971)
-     )
-    )
-    (set_local $7
-     (i32.const 178956970)
-    )
-    (block $label$2
-     (block $label$3
-      (br_if $label$3
-       (i32.gt_u
-        (tee_local $6
-         (i32.div_s
-          (i32.sub
-           (i32.load offset=8
-            (get_local $0)
-           )
-           (get_local $6)
-          )
-          (i32.const 24)
-         )
-        )
-        (i32.const 89478484)
-       )
-      )
-      (br_if $label$2
-       (i32.eqz
-        (tee_local $7
-         (select
-          (get_local $5)
-          (tee_local $7
-           (i32.shl
-            (get_local $6)
-            (i32.const 1)
-           )
-          )
-          (i32.lt_u
-           (get_local $7)
-           (get_local $5)
-          )
-         )
-        )
-       )
-      )
-     )
-     (set_local $6
-      (call $_Znwj
-       (i32.mul
-        (get_local $7)
-        (i32.const 24)
-       )
-      )
-     )
-     (br $label$0)
-    )
-    (set_local $7
-     (i32.const 0)
-    )
-    (set_local $6
-     (i32.const 0)
-    )
-    (br $label$0)
-   )
-   (call $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv
-    (get_local $0)
-   )
-   (unreachable)
-  )
-  (set_local $5
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (i32.store
-   (get_local $1)
-   (i32.const 0)
-  )
-  (i32.store
-   (tee_local $1
-    (i32.add
-     (get_local $6)
-     (i32.mul
-      (get_local $4)
-      (i32.const 24)
-     )
-    )
-   )
-   (get_local $5)
-  )
-  (i64.store offset=8
-   (get_local $1)
-   (i64.load
-    (get_local $2)
-   )
-  )
-  (i32.store offset=16
-   (get_local $1)
-   (i32.load
-    (get_local $3)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $6)
-    (i32.mul
-     (get_local $7)
-     (i32.const 24)
-    )
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $1)
-    (i32.const 24)
-   )
-  )
-  (block $label$4
-   (block $label$5
-    (br_if $label$5
-     (i32.eq
-      (tee_local $6
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 4)
-        )
-       )
-      )
-      (tee_local $7
-       (i32.load
-        (get_local $0)
-       )
-      )
-     )
-    )
-    (loop $label$6
-     (set_local $3
-      (i32.load
-       (tee_local $2
-        (i32.add
-         (get_local $6)
-         (i32.const -24)
-        )
-       )
-      )
-     )
-     (i32.store
-      (get_local $2)
-      (i32.const 0)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -24)
-      )
-      (get_local $3)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -8)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -8)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -12)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -12)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -16)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -16)
-       )
-      )
-     )
-     (set_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const -24)
-      )
-     )
-     (set_local $6
-      (get_local $2)
-     )
-     (br_if $label$6
-      (i32.ne
-       (get_local $7)
-       (get_local $2)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $6
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (br $label$4)
-   )
-   (set_local $6
-    (get_local $7)
-   )
-  )
-  (i32.store
-   (get_local $0)
-   (get_local $1)
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-   (get_local $5)
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-   (get_local $4)
-  )
-  (block $label$7
-   (br_if $label$7
-    (i32.eq
-     (get_local $7)
-     (get_local $6)
-    )
-   )
-   (loop $label$8
-    (set_local $1
-     (i32.load
-      (tee_local $7
-       (i32.add
-        (get_local $7)
-        (i32.const -24)
-       )
-      )
-     )
-    )
-    (i32.store
-     (get_local $7)
-     (i32.const 0)
-    )
-    (block $label$9
-     (br_if $label$9
-      (i32.eqz
-       (get_local $1)
-      )
-     )
-     (call $_ZdlPv
-      (get_local $1)
-     )
-    )
-    (br_if $label$8
-     (i32.ne
-      (get_local $6)
-      (get_local $7)
-     )
-    )
-   )
-  )
-  (block $label$10
-   (br_if $label$10
-    (i32.eqz
-     (get_local $6)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $6)
-   )
-  )
- )
- (func $_ZN5boost3pfr6detail19for_each_field_implINS1_14sequence_tuple5tupleIJRN5eosio5assetES7_RyEEEZNS5_rsINS5_10datastreamIPKcEENS5_5token14currency_statsELPv0EEERT_SJ_RT0_EUlSJ_E_JLj0ELj1ELj2EEEEvSJ_OSK_NSt3__116integer_sequenceIjJXspT1_EEEENSO_17integral_constantIbLb0EEE (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (set_local $3
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $2)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (get_local $3)
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (tee_local $4
-    (i32.add
-     (i32.load offset=4
-      (get_local $2)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (get_local $2)
-     )
-     (get_local $4)
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $3)
-     (i32.const 8)
-    )
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (i32.add
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (set_local $3
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $2)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (get_local $3)
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (tee_local $4
-    (i32.add
-     (i32.load offset=4
-      (get_local $2)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (get_local $2)
-     )
-     (get_local $4)
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $3)
-     (i32.const 8)
-    )
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (i32.add
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (set_local $0
-   (i32.load offset=8
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $2)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (get_local $0)
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $2)
-   (i32.add
-    (i32.load offset=4
-     (get_local $2)
-    )
-    (i32.const 8)
-   )
-  )
- )
- (func $_ZN5eosio5token5issueEyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE (type $FUNCSIG$vijii) (param $0 i32) (param $1 i64) (param $2 i32) (param $3 i32)
-  (local $4 i32)
-  (local $5 i64)
-  (local $6 i64)
-  (local $7 i32)
-  (local $8 i64)
-  (local $9 i32)
-  (local $10 i32)
-  (local $11 i64)
-  (local $12 i64)
-  (local $13 i64)
-  (local $14 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $14
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 224)
-    )
-   )
-  )
-  (set_local $9
-   (i32.const 0)
-  )
-  (set_local $8
-   (tee_local $13
-    (i64.shr_u
-     (tee_local $11
-      (i64.load offset=8
-       (get_local $2)
-      )
-     )
-     (i64.const 8)
-    )
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (loop $label$2
-     (br_if $label$1
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $8)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$3
-      (br_if $label$3
-       (i64.ne
-        (i64.and
-         (tee_local $8
-          (i64.shr_u
-           (get_local $8)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$4
-       (br_if $label$1
-        (i64.ne
-         (i64.and
-          (tee_local $8
-           (i64.shr_u
-            (get_local $8)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$4
-        (i32.lt_s
-         (tee_local $9
-          (i32.add
-           (get_local $9)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $7
-      (i32.const 1)
-     )
-     (br_if $label$2
-      (i32.lt_s
-       (tee_local $9
-        (i32.add
-         (get_local $9)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$0)
-    )
-   )
-   (set_local $7
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $7)
-   (i32.const 16)
-  )
-  (block $label$5
-   (block $label$6
-    (br_if $label$6
-     (i32.and
-      (tee_local $9
-       (i32.load8_u
-        (get_local $3)
-       )
-      )
-      (i32.const 1)
-     )
-    )
-    (set_local $9
-     (i32.shr_u
-      (get_local $9)
-      (i32.const 1)
-     )
-    )
-    (br $label$5)
-   )
-   (set_local $9
-    (i32.load offset=4
-     (get_local $3)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.lt_u
-    (get_local $9)
-    (i32.const 257)
-   )
-   (i32.const 400)
-  )
-  (set_local $10
-   (i32.const 0)
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $14)
-     (i32.const 88)
-    )
-    (i32.const 32)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=104
-   (get_local $14)
-   (i64.const -1)
-  )
-  (i64.store offset=112
-   (get_local $14)
-   (i64.const 0)
-  )
-  (i64.store offset=88
-   (get_local $14)
-   (tee_local $8
-    (i64.load
-     (get_local $0)
-    )
-   )
-  )
-  (i64.store offset=96
-   (get_local $14)
-   (get_local $13)
-  )
-  (set_local $7
-   (i32.const 0)
-  )
-  (block $label$7
-   (br_if $label$7
-    (i32.lt_s
-     (tee_local $9
-      (call $db_find_i64
-       (get_local $8)
-       (get_local $13)
-       (i64.const -4157508551318700032)
-       (get_local $13)
-      )
-     )
-     (i32.const 0)
-    )
-   )
-   (call $eosio_assert
-    (i32.eq
-     (i32.load offset=40
-      (tee_local $7
-       (call $_ZNK5eosio11multi_indexILy14289235522390851584ENS_5token14currency_statsEJEE31load_object_by_primary_iteratorEl
-        (i32.add
-         (get_local $14)
-         (i32.const 88)
-        )
-        (get_local $9)
-       )
-      )
-     )
-     (i32.add
-      (get_local $14)
-      (i32.const 88)
-     )
-    )
-    (i32.const 96)
-   )
-  )
-  (call $eosio_assert
-   (i32.ne
-    (get_local $7)
-    (i32.const 0)
-   )
-   (i32.const 432)
-  )
-  (call $require_auth
-   (i64.load offset=32
-    (get_local $7)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $7)
-    (i32.const 32)
-   )
-  )
-  (block $label$8
-   (br_if $label$8
-    (i64.gt_u
-     (i64.add
-      (tee_local $8
-       (i64.load
-        (get_local $2)
-       )
-      )
-      (i64.const 4611686018427387903)
-     )
-     (i64.const 9223372036854775806)
-    )
-   )
-   (set_local $9
-    (i32.const 0)
-   )
-   (block $label$9
-    (loop $label$10
-     (br_if $label$9
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $13)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$11
-      (br_if $label$11
-       (i64.ne
-        (i64.and
-         (tee_local $13
-          (i64.shr_u
-           (get_local $13)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$12
-       (br_if $label$9
-        (i64.ne
-         (i64.and
-          (tee_local $13
-           (i64.shr_u
-            (get_local $13)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$12
-        (i32.lt_s
-         (tee_local $9
-          (i32.add
-           (get_local $9)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $10
-      (i32.const 1)
-     )
-     (br_if $label$10
-      (i32.lt_s
-       (tee_local $9
-        (i32.add
-         (get_local $9)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$8)
-    )
-   )
-   (set_local $10
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $10)
-   (i32.const 496)
-  )
-  (call $eosio_assert
-   (i64.gt_s
-    (get_local $8)
-    (i64.const 0)
-   )
-   (i32.const 528)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (get_local $11)
-    (i64.load offset=8
-     (get_local $7)
-    )
-   )
-   (i32.const 560)
-  )
-  (call $eosio_assert
-   (i64.le_s
-    (get_local $8)
-    (i64.sub
-     (i64.load offset=16
-      (get_local $7)
-     )
-     (i64.load
-      (get_local $7)
-     )
-    )
-   )
-   (i32.const 592)
-  )
-  (call $eosio_assert
-   (i32.eq
-    (i32.load offset=40
-     (get_local $7)
-    )
-    (i32.add
-     (get_local $14)
-     (i32.const 88)
-    )
-   )
-   (i32.const 640)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (i64.load offset=88
-     (get_local $14)
-    )
-    (call $current_receiver)
-   )
-   (i32.const 688)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (get_local $11)
-    (tee_local $13
-     (i64.load offset=8
-      (get_local $7)
-     )
-    )
-   )
-   (i32.const 752)
-  )
-  (i64.store
-   (get_local $7)
-   (tee_local $8
-    (i64.add
-     (i64.load
-      (get_local $7)
-     )
-     (get_local $8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i64.gt_s
-    (get_local $8)
-    (i64.const -4611686018427387904)
-   )
-   (i32.const 800)
-  )
-  (call $eosio_assert
-   (i64.lt_s
-    (i64.load
-     (get_local $7)
-    )
-    (i64.const 4611686018427387904)
-   )
-   (i32.const 832)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (tee_local $8
-     (i64.shr_u
-      (get_local $13)
-      (i64.const 8)
-     )
-    )
-    (i64.shr_u
-     (i64.load offset=8
-      (get_local $7)
-     )
-     (i64.const 8)
-    )
-   )
-   (i32.const 864)
-  )
-  (i32.store offset=192
-   (get_local $14)
-   (i32.add
-    (i32.add
-     (get_local $14)
-     (i32.const 128)
-    )
-    (i32.const 40)
-   )
-  )
-  (i32.store offset=188
-   (get_local $14)
-   (i32.add
-    (get_local $14)
-    (i32.const 128)
-   )
-  )
-  (i32.store offset=184
-   (get_local $14)
-   (i32.add
-    (get_local $14)
-    (i32.const 128)
-   )
-  )
-  (i32.store offset=200
-   (get_local $14)
-   (i32.add
-    (get_local $14)
-    (i32.const 184)
-   )
-  )
-  (i32.store offset=212
-   (get_local $14)
-   (i32.add
-    (get_local $7)
-    (i32.const 16)
-   )
-  )
-  (i32.store offset=208
-   (get_local $14)
-   (get_local $7)
-  )
-  (i32.store offset=216
-   (get_local $14)
-   (get_local $4)
-  )
-  (call $_ZN5boost3pfr6detail19for_each_field_implINS1_14sequence_tuple5tupleIJRKN5eosio5assetES8_RKyEEEZNS5_lsINS5_10datastreamIPcEENS5_5token14currency_statsELPv0EEERT_SK_RKT0_EUlRKSJ_E_JLj0ELj1ELj2EEEEvSK_OSL_NSt3__116integer_sequenceIjJXspT1_EEEENSS_17integral_constantIbLb0EEE
-   (i32.add
-    (get_local $14)
-    (i32.const 208)
-   )
-   (i32.add
-    (get_local $14)
-    (i32.const 200)
-   )
-  )
-  (call $db_update_i64
-   (i32.load offset=44
-    (get_local $7)
-   )
-   (i64.const 0)
-   (i32.add
-    (get_local $14)
-    (i32.const 128)
-   )
-   (i32.const 40)
-  )
-  (block $label$13
-   (br_if $label$13
-    (i64.lt_u
-     (get_local $8)
-     (i64.load
-      (tee_local $9
-       (i32.add
-        (i32.add
-         (get_local $14)
-         (i32.const 88)
-        )
-        (i32.const 16)
-       )
-      )
-     )
-    )
-   )
-   (i64.store
-    (get_local $9)
-    (i64.add
-     (get_local $8)
-     (i64.const 1)
-    )
-   )
-  )
-  (i32.store
-   (tee_local $9
-    (i32.add
-     (i32.add
-      (get_local $14)
-      (i32.const 72)
-     )
-     (i32.const 12)
-    )
-   )
-   (i32.load
-    (i32.add
-     (get_local $2)
-     (i32.const 12)
-    )
-   )
-  )
-  (i32.store
-   (tee_local $7
-    (i32.add
-     (i32.add
-      (get_local $14)
-      (i32.const 72)
-     )
-     (i32.const 8)
-    )
-   )
-   (i32.load
-    (i32.add
-     (get_local $2)
-     (i32.const 8)
-    )
-   )
-  )
-  (i32.store offset=76
-   (get_local $14)
-   (i32.load
-    (i32.add
-     (get_local $2)
-     (i32.const 4)
-    )
-   )
-  )
-  (i32.store offset=72
-   (get_local $14)
-   (i32.load
-    (get_local $2)
-   )
-  )
-  (set_local $8
-   (i64.load
-    (get_local $4)
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $14)
-     (i32.const 8)
-    )
-    (i32.const 12)
-   )
-   (i32.load
-    (get_local $9)
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $14)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-   (i32.load
-    (get_local $7)
-   )
-  )
-  (i32.store offset=12
-   (get_local $14)
-   (i32.load offset=76
-    (get_local $14)
-   )
-  )
-  (i32.store offset=8
-   (get_local $14)
-   (i32.load offset=72
-    (get_local $14)
-   )
-  )
-  (call $_ZN5eosio5token11add_balanceEyNS_5assetEy
-   (get_local $0)
-   (get_local $8)
-   (i32.add
-    (get_local $14)
-    (i32.const 8)
-   )
-   (get_local $8)
-  )
-  (block $label$14
-   (br_if $label$14
-    (i64.eq
-     (tee_local $5
-      (i64.load
-       (get_local $4)
-      )
-     )
-     (get_local $1)
-    )
-   )
-   (set_local $6
-    (i64.load
-     (get_local $0)
-    )
-   )
-   (set_local $8
-    (i64.const 0)
-   )
-   (set_local $11
-    (i64.const 59)
-   )
-   (set_local $9
-    (i32.const 928)
-   )
-   (set_local $12
-    (i64.const 0)
-   )
-   (loop $label$15
-    (block $label$16
-     (block $label$17
-      (block $label$18
-       (block $label$19
-        (block $label$20
-         (br_if $label$20
-          (i64.gt_u
-           (get_local $8)
-           (i64.const 5)
-          )
-         )
-         (br_if $label$19
-          (i32.gt_u
-           (i32.and
-            (i32.add
-             (tee_local $7
-              (i32.load8_s
-               (get_local $9)
-              )
-             )
-             (i32.const -97)
-            )
-            (i32.const 255)
-           )
-           (i32.const 25)
-          )
-         )
-         (set_local $7
-          (i32.add
-           (get_local $7)
-           (i32.const 165)
-          )
-         )
-         (br $label$18)
-        )
-        (set_local $13
-         (i64.const 0)
-        )
-        (br_if $label$17
-         (i64.le_u
-          (get_local $8)
-          (i64.const 11)
-         )
-        )
-        (br $label$16)
-       )
-       (set_local $7
-        (select
-         (i32.add
-          (get_local $7)
-          (i32.const 208)
-         )
-         (i32.const 0)
-         (i32.lt_u
-          (i32.and
-           (i32.add
-            (get_local $7)
-            (i32.const -49)
-           )
-           (i32.const 255)
-          )
-          (i32.const 5)
-         )
-        )
-       )
-      )
-      (set_local $13
-       (i64.shr_s
-        (i64.shl
-         (i64.extend_u/i32
-          (get_local $7)
-         )
-         (i64.const 56)
-        )
-        (i64.const 56)
-       )
-      )
-     )
-     (set_local $13
-      (i64.shl
-       (i64.and
-        (get_local $13)
-        (i64.const 31)
-       )
-       (i64.and
-        (get_local $11)
-        (i64.const 4294967295)
-       )
-      )
-     )
-    )
-    (set_local $9
-     (i32.add
-      (get_local $9)
-      (i32.const 1)
-     )
-    )
-    (set_local $8
-     (i64.add
-      (get_local $8)
-      (i64.const 1)
-     )
-    )
-    (set_local $12
-     (i64.or
-      (get_local $13)
-      (get_local $12)
-     )
-    )
-    (br_if $label$15
-     (i64.ne
-      (tee_local $11
-       (i64.add
-        (get_local $11)
-        (i64.const -5)
-       )
-      )
-      (i64.const -6)
-     )
-    )
-   )
-   (i32.store
-    (i32.add
-     (get_local $14)
-     (i32.const 52)
-    )
-    (i32.load
-     (i32.add
-      (get_local $2)
-      (i32.const 12)
-     )
-    )
-   )
-   (i32.store
-    (tee_local $7
-     (i32.add
-      (i32.add
-       (get_local $14)
-       (i32.const 24)
-      )
-      (i32.const 24)
-     )
-    )
-    (i32.load
-     (i32.add
-      (get_local $2)
-      (i32.const 8)
-     )
-    )
-   )
-   (i32.store
-    (i32.add
-     (get_local $14)
-     (i32.const 44)
-    )
-    (i32.load
-     (i32.add
-      (get_local $2)
-      (i32.const 4)
-     )
-    )
-   )
-   (i64.store offset=32
-    (get_local $14)
-    (get_local $1)
-   )
-   (i64.store offset=24
-    (get_local $14)
-    (get_local $5)
-   )
-   (i32.store offset=40
-    (get_local $14)
-    (i32.load
-     (get_local $2)
-    )
-   )
-   (drop
-    (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-     (i32.add
-      (get_local $14)
-      (i32.const 56)
-     )
-     (get_local $3)
-    )
-   )
-   (i64.store
-    (tee_local $9
-     (call $_Znwj
-      (i32.const 16)
-     )
-    )
-    (get_local $5)
-   )
-   (i64.store offset=8
-    (get_local $9)
-    (get_local $12)
-   )
-   (i32.store offset=208
-    (get_local $14)
-    (get_local $9)
-   )
-   (i32.store offset=216
-    (get_local $14)
-    (tee_local $9
-     (i32.add
-      (get_local $9)
-      (i32.const 16)
-     )
-    )
-   )
-   (i32.store offset=212
-    (get_local $14)
-    (get_local $9)
-   )
-   (i64.store offset=128
-    (get_local $14)
-    (i64.load offset=24
-     (get_local $14)
-    )
-   )
-   (i64.store offset=136
-    (get_local $14)
-    (i64.load offset=32
-     (get_local $14)
-    )
-   )
-   (i64.store
-    (i32.add
-     (i32.add
-      (get_local $14)
-      (i32.const 128)
-     )
-     (i32.const 24)
-    )
-    (i64.load
-     (get_local $7)
-    )
-   )
-   (i64.store offset=144
-    (get_local $14)
-    (i64.load offset=40
-     (get_local $14)
-    )
-   )
-   (i32.store
-    (tee_local $7
-     (i32.add
-      (i32.add
-       (get_local $14)
-       (i32.const 128)
-      )
-      (i32.const 40)
-     )
-    )
-    (i32.load
-     (tee_local $9
-      (i32.add
-       (i32.add
-        (get_local $14)
-        (i32.const 24)
-       )
-       (i32.const 40)
-      )
-     )
-    )
-   )
-   (i64.store offset=160
-    (get_local $14)
-    (i64.load offset=56
-     (get_local $14)
-    )
-   )
-   (i32.store offset=56
-    (get_local $14)
-    (i32.const 0)
-   )
-   (i32.store
-    (i32.add
-     (get_local $14)
-     (i32.const 60)
-    )
-    (i32.const 0)
-   )
-   (i32.store
-    (get_local $9)
-    (i32.const 0)
-   )
-   (call $_ZN5eosio15dispatch_inlineIJyyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEEEEEvyyNS2_6vectorINS_16permission_levelENS6_ISA_EEEENS2_5tupleIJDpT_EEE
-    (get_local $6)
-    (i64.const -3617168760277827584)
-    (i32.add
-     (get_local $14)
-     (i32.const 208)
-    )
-    (i32.add
-     (get_local $14)
-     (i32.const 128)
-    )
-   )
-   (block $label$21
-    (br_if $label$21
-     (i32.eqz
-      (i32.and
-       (i32.load8_u offset=160
-        (get_local $14)
-       )
-       (i32.const 1)
-      )
-     )
-    )
-    (call $_ZdlPv
-     (i32.load
-      (get_local $7)
-     )
-    )
-   )
-   (block $label$22
-    (br_if $label$22
-     (i32.eqz
-      (tee_local $9
-       (i32.load offset=208
-        (get_local $14)
-       )
-      )
-     )
-    )
-    (i32.store offset=212
-     (get_local $14)
-     (get_local $9)
-    )
-    (call $_ZdlPv
-     (get_local $9)
-    )
-   )
-   (br_if $label$14
-    (i32.eqz
-     (i32.and
-      (i32.load8_u
-       (i32.add
-        (get_local $14)
-        (i32.const 56)
-       )
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load
-     (i32.add
-      (get_local $14)
-      (i32.const 64)
-     )
-    )
-   )
-  )
-  (block $label$23
-   (br_if $label$23
-    (i32.eqz
-     (tee_local $2
-      (i32.load offset=112
-       (get_local $14)
-      )
-     )
-    )
-   )
-   (block $label$24
-    (block $label$25
-     (br_if $label$25
-      (i32.eq
-       (tee_local $9
-        (i32.load
-         (tee_local $10
-          (i32.add
-           (get_local $14)
-           (i32.const 116)
-          )
-         )
-        )
-       )
-       (get_local $2)
-      )
-     )
-     (loop $label$26
-      (set_local $7
-       (i32.load
-        (tee_local $9
-         (i32.add
-          (get_local $9)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $9)
-       (i32.const 0)
-      )
-      (block $label$27
-       (br_if $label$27
-        (i32.eqz
-         (get_local $7)
-        )
-       )
-       (call $_ZdlPv
-        (get_local $7)
-       )
-      )
-      (br_if $label$26
-       (i32.ne
-        (get_local $2)
-        (get_local $9)
-       )
-      )
-     )
-     (set_local $9
-      (i32.load
-       (i32.add
-        (get_local $14)
-        (i32.const 112)
-       )
-      )
-     )
-     (br $label$24)
-    )
-    (set_local $9
-     (get_local $2)
-    )
-   )
-   (i32.store
-    (get_local $10)
-    (get_local $2)
-   )
-   (call $_ZdlPv
-    (get_local $9)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $14)
-    (i32.const 224)
-   )
-  )
- )
- (func $_ZN5eosio5token11add_balanceEyNS_5assetEy (param $0 i32) (param $1 i64) (param $2 i32) (param $3 i64)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 80)
-    )
-   )
-  )
-  (set_local $8
-   (i32.const 0)
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $9)
-     (i32.const 8)
-    )
-    (i32.const 32)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=24
-   (get_local $9)
-   (i64.const -1)
-  )
-  (i64.store offset=32
-   (get_local $9)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $9)
-   (tee_local $6
-    (i64.load
-     (get_local $0)
-    )
-   )
-  )
-  (i64.store offset=16
-   (get_local $9)
-   (get_local $1)
-  )
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (br_if $label$3
-       (i32.lt_s
-        (tee_local $0
-         (call $db_find_i64
-          (get_local $6)
-          (get_local $1)
-          (i64.const 3607749779137757184)
-          (i64.shr_u
-           (tee_local $4
-            (i64.load offset=8
-             (get_local $2)
-            )
-           )
-           (i64.const 8)
-          )
-         )
-        )
-        (i32.const 0)
-       )
-      )
-      (call $eosio_assert
-       (i32.eq
-        (i32.load offset=16
-         (tee_local $8
-          (call $_ZNK5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE31load_object_by_primary_iteratorEl
-           (i32.add
-            (get_local $9)
-            (i32.const 8)
-           )
-           (get_local $0)
-          )
-         )
-        )
-        (i32.add
-         (get_local $9)
-         (i32.const 8)
-        )
-       )
-       (i32.const 96)
-      )
-      (call $eosio_assert
-       (i32.const 1)
-       (i32.const 944)
-      )
-      (call $eosio_assert
-       (i32.eq
-        (i32.load offset=16
-         (get_local $8)
-        )
-        (i32.add
-         (get_local $9)
-         (i32.const 8)
-        )
-       )
-       (i32.const 640)
-      )
-      (call $eosio_assert
-       (i64.eq
-        (i64.load offset=8
-         (get_local $9)
-        )
-        (call $current_receiver)
-       )
-       (i32.const 688)
-      )
-      (call $eosio_assert
-       (i64.eq
-        (get_local $4)
-        (tee_local $1
-         (i64.load offset=8
-          (get_local $8)
-         )
-        )
-       )
-       (i32.const 752)
-      )
-      (i64.store
-       (get_local $8)
-       (tee_local $6
-        (i64.add
-         (i64.load
-          (get_local $8)
-         )
-         (i64.load
-          (get_local $2)
-         )
-        )
-       )
-      )
-      (call $eosio_assert
-       (i64.gt_s
-        (get_local $6)
-        (i64.const -4611686018427387904)
-       )
-       (i32.const 800)
-      )
-      (call $eosio_assert
-       (i64.lt_s
-        (i64.load
-         (get_local $8)
-        )
-        (i64.const 4611686018427387904)
-       )
-       (i32.const 832)
-      )
-      (call $eosio_assert
-       (i64.eq
-        (tee_local $1
-         (i64.shr_u
-          (get_local $1)
-          (i64.const 8)
-         )
-        )
-        (i64.shr_u
-         (i64.load offset=8
-          (get_local $8)
-         )
-         (i64.const 8)
-        )
-       )
-       (i32.const 864)
-      )
-      (call $eosio_assert
-       (i32.const 1)
-       (i32.const 272)
-      )
-      (drop
-       (call $memcpy
-        (i32.add
-         (get_local $9)
-         (i32.const 64)
-        )
-        (get_local $8)
-        (i32.const 8)
-       )
-      )
-      (call $eosio_assert
-       (i32.const 1)
-       (i32.const 272)
-      )
-      (drop
-       (call $memcpy
-        (i32.or
-         (i32.add
-          (get_local $9)
-          (i32.const 64)
-         )
-         (i32.const 8)
-        )
-        (i32.add
-         (get_local $8)
-         (i32.const 8)
-        )
-        (i32.const 8)
-       )
-      )
-      (call $db_update_i64
-       (i32.load offset=20
-        (get_local $8)
-       )
-       (i64.const 0)
-       (i32.add
-        (get_local $9)
-        (i32.const 64)
-       )
-       (i32.const 16)
-      )
-      (br_if $label$2
-       (i64.lt_u
-        (get_local $1)
-        (i64.load
-         (tee_local $8
-          (i32.add
-           (i32.add
-            (get_local $9)
-            (i32.const 8)
-           )
-           (i32.const 16)
-          )
-         )
-        )
-       )
-      )
-      (i64.store
-       (get_local $8)
-       (i64.add
-        (get_local $1)
-        (i64.const 1)
-       )
-      )
-      (br_if $label$1
-       (tee_local $2
-        (i32.load offset=32
-         (get_local $9)
-        )
-       )
-      )
-      (br $label$0)
-     )
-     (call $eosio_assert
-      (i64.eq
-       (i64.load offset=8
-        (get_local $9)
-       )
-       (call $current_receiver)
-      )
-      (i32.const 208)
-     )
-     (i64.store offset=8
-      (tee_local $0
-       (call $_Znwj
-        (i32.const 32)
-       )
-      )
-      (i64.const 1398362884)
-     )
-     (i64.store
-      (get_local $0)
-      (i64.const 0)
-     )
-     (call $eosio_assert
-      (i32.const 1)
-      (i32.const 288)
-     )
-     (set_local $5
-      (i32.add
-       (get_local $0)
-       (i32.const 8)
-      )
-     )
-     (set_local $1
-      (i64.const 5462355)
-     )
-     (block $label$4
-      (loop $label$5
-       (set_local $7
-        (i32.const 0)
-       )
-       (br_if $label$4
-        (i32.gt_u
-         (i32.add
-          (i32.shl
-           (i32.wrap/i64
-            (get_local $1)
-           )
-           (i32.const 24)
-          )
-          (i32.const -1073741825)
-         )
-         (i32.const 452984830)
-        )
-       )
-       (block $label$6
-        (br_if $label$6
-         (i64.ne
-          (i64.and
-           (tee_local $1
-            (i64.shr_u
-             (get_local $1)
-             (i64.const 8)
-            )
-           )
-           (i64.const 255)
-          )
-          (i64.const 0)
-         )
-        )
-        (loop $label$7
-         (br_if $label$4
-          (i64.ne
-           (i64.and
-            (tee_local $1
-             (i64.shr_u
-              (get_local $1)
-              (i64.const 8)
-             )
-            )
-            (i64.const 255)
-           )
-           (i64.const 0)
-          )
-         )
-         (br_if $label$7
-          (i32.lt_s
-           (tee_local $8
-            (i32.add
-             (get_local $8)
-             (i32.const 1)
-            )
-           )
-           (i32.const 7)
-          )
-         )
-        )
-       )
-       (set_local $7
-        (i32.const 1)
-       )
-       (br_if $label$5
-        (i32.lt_s
-         (tee_local $8
-          (i32.add
-           (get_local $8)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (call $eosio_assert
-      (get_local $7)
-      (i32.const 16)
-     )
-     (i32.store offset=16
-      (get_local $0)
-      (i32.add
-       (get_local $9)
-       (i32.const 8)
-      )
-     )
-     (i64.store
-      (tee_local $8
-       (i32.add
-        (get_local $0)
-        (i32.const 8)
-       )
-      )
-      (i64.load
-       (i32.add
-        (get_local $2)
-        (i32.const 8)
-       )
-      )
-     )
-     (i64.store
-      (get_local $0)
-      (i64.load
-       (get_local $2)
-      )
-     )
-     (call $eosio_assert
-      (i32.const 1)
-      (i32.const 272)
-     )
-     (drop
-      (call $memcpy
-       (i32.add
-        (get_local $9)
-        (i32.const 64)
-       )
-       (get_local $0)
-       (i32.const 8)
-      )
-     )
-     (call $eosio_assert
-      (i32.const 1)
-      (i32.const 272)
-     )
-     (drop
-      (call $memcpy
-       (i32.or
-        (i32.add
-         (get_local $9)
-         (i32.const 64)
-        )
-        (i32.const 8)
-       )
-       (get_local $5)
-       (i32.const 8)
-      )
-     )
-     (i32.store offset=20
-      (get_local $0)
-      (tee_local $2
-       (call $db_store_i64
-        (i64.load
-         (i32.add
-          (i32.add
-           (get_local $9)
-           (i32.const 8)
-          )
-          (i32.const 8)
-         )
-        )
-        (i64.const 3607749779137757184)
-        (get_local $3)
-        (tee_local $1
-         (i64.shr_u
-          (i64.load
-           (get_local $8)
-          )
-          (i64.const 8)
-         )
-        )
-        (i32.add
-         (get_local $9)
-         (i32.const 64)
-        )
-        (i32.const 16)
-       )
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i64.lt_u
-        (get_local $1)
-        (i64.load
-         (tee_local $7
-          (i32.add
-           (i32.add
-            (get_local $9)
-            (i32.const 8)
-           )
-           (i32.const 16)
-          )
-         )
-        )
-       )
-      )
-      (i64.store
-       (get_local $7)
-       (i64.add
-        (get_local $1)
-        (i64.const 1)
-       )
-      )
-     )
-     (i32.store offset=56
-      (get_local $9)
-      (get_local $0)
-     )
-     (i64.store offset=64
-      (get_local $9)
-      (tee_local $1
-       (i64.shr_u
-        (i64.load
-         (get_local $8)
-        )
-        (i64.const 8)
-       )
-      )
-     )
-     (i32.store offset=52
-      (get_local $9)
-      (get_local $2)
-     )
-     (block $label$9
-      (block $label$10
-       (br_if $label$10
-        (i32.ge_u
-         (tee_local $8
-          (i32.load
-           (tee_local $7
-            (i32.add
-             (get_local $9)
-             (i32.const 36)
-            )
-           )
-          )
-         )
-         (i32.load
-          (i32.add
-           (get_local $9)
-           (i32.const 40)
-          )
-         )
-        )
-       )
-       (i64.store offset=8
-        (get_local $8)
-        (get_local $1)
-       )
-       (i32.store offset=16
-        (get_local $8)
-        (get_local $2)
-       )
-       (i32.store offset=56
-        (get_local $9)
-        (i32.const 0)
-       )
-       (i32.store
-        (get_local $8)
-        (get_local $0)
-       )
-       (i32.store
-        (get_local $7)
-        (i32.add
-         (get_local $8)
-         (i32.const 24)
-        )
-       )
-       (br $label$9)
-      )
-      (call $_ZNSt3__16vectorIN5eosio11multi_indexILy3607749779137757184ENS1_5token7accountEJEE8item_ptrENS_9allocatorIS6_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS5_4itemENS_14default_deleteISC_EEEERyRlEEEvDpOT_
-       (i32.add
-        (get_local $9)
-        (i32.const 32)
-       )
-       (i32.add
-        (get_local $9)
-        (i32.const 56)
-       )
-       (i32.add
-        (get_local $9)
-        (i32.const 64)
-       )
-       (i32.add
-        (get_local $9)
-        (i32.const 52)
-       )
-      )
-     )
-     (set_local $8
-      (i32.load offset=56
-       (get_local $9)
-      )
-     )
-     (i32.store offset=56
-      (get_local $9)
-      (i32.const 0)
-     )
-     (br_if $label$2
-      (i32.eqz
-       (get_local $8)
-      )
-     )
-     (call $_ZdlPv
-      (get_local $8)
-     )
-    )
-    (br_if $label$0
-     (i32.eqz
-      (tee_local $2
-       (i32.load offset=32
-        (get_local $9)
-       )
-      )
-     )
-    )
-   )
-   (block $label$11
-    (block $label$12
-     (br_if $label$12
-      (i32.eq
-       (tee_local $8
-        (i32.load
-         (tee_local $7
-          (i32.add
-           (get_local $9)
-           (i32.const 36)
-          )
-         )
-        )
-       )
-       (get_local $2)
-      )
-     )
-     (loop $label$13
-      (set_local $0
-       (i32.load
-        (tee_local $8
-         (i32.add
-          (get_local $8)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $8)
-       (i32.const 0)
-      )
-      (block $label$14
-       (br_if $label$14
-        (i32.eqz
-         (get_local $0)
-        )
-       )
-       (call $_ZdlPv
-        (get_local $0)
-       )
-      )
-      (br_if $label$13
-       (i32.ne
-        (get_local $2)
-        (get_local $8)
-       )
-      )
-     )
-     (set_local $8
-      (i32.load
-       (i32.add
-        (get_local $9)
-        (i32.const 32)
-       )
-      )
-     )
-     (br $label$11)
-    )
-    (set_local $8
-     (get_local $2)
-    )
-   )
-   (i32.store
-    (get_local $7)
-    (get_local $2)
-   )
-   (call $_ZdlPv
-    (get_local $8)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 80)
-   )
-  )
- )
- (func $_ZN5eosio15dispatch_inlineIJyyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEEEEEvyyNS2_6vectorINS_16permission_levelENS6_ISA_EEEENS2_5tupleIJDpT_EEE (param $0 i64) (param $1 i64) (param $2 i32) (param $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 96)
-    )
-   )
-  )
-  (i32.store offset=16
-   (get_local $9)
-   (i32.const 0)
-  )
-  (i64.store offset=8
-   (get_local $9)
-   (i64.const 0)
-  )
-  (set_local $6
-   (i32.const 0)
-  )
-  (set_local $7
-   (i32.const 0)
-  )
-  (set_local $8
-   (i32.const 0)
-  )
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (tee_local $5
-       (i32.shr_s
-        (tee_local $4
-         (i32.sub
-          (i32.load offset=4
-           (get_local $2)
-          )
-          (i32.load
-           (get_local $2)
-          )
-         )
-        )
-        (i32.const 4)
-       )
-      )
-     )
-    )
-    (br_if $label$0
-     (i32.ge_u
-      (get_local $5)
-      (i32.const 268435456)
-     )
-    )
-    (i32.store
-     (i32.add
-      (get_local $9)
-      (i32.const 16)
-     )
-     (tee_local $6
-      (i32.add
-       (tee_local $8
-        (call $_Znwj
-         (get_local $4)
-        )
-       )
-       (i32.shl
-        (get_local $5)
-        (i32.const 4)
-       )
-      )
-     )
-    )
-    (i32.store offset=8
-     (get_local $9)
-     (get_local $8)
-    )
-    (i32.store offset=12
-     (get_local $9)
-     (get_local $8)
-    )
-    (block $label$2
-     (br_if $label$2
-      (i32.lt_s
-       (tee_local $2
-        (i32.sub
-         (i32.load
-          (i32.add
-           (get_local $2)
-           (i32.const 4)
-          )
-         )
-         (tee_local $7
-          (i32.load
-           (get_local $2)
-          )
-         )
-        )
-       )
-       (i32.const 1)
-      )
-     )
-     (drop
-      (call $memcpy
-       (get_local $8)
-       (get_local $7)
-       (get_local $2)
-      )
-     )
-     (i32.store offset=12
-      (get_local $9)
-      (tee_local $7
-       (i32.add
-        (get_local $8)
-        (get_local $2)
-       )
-      )
-     )
-     (br $label$1)
-    )
-    (set_local $7
-     (get_local $8)
-    )
-   )
-   (i32.store
-    (i32.add
-     (get_local $9)
-     (i32.const 44)
-    )
-    (get_local $7)
-   )
-   (i64.store offset=32
-    (get_local $9)
-    (get_local $1)
-   )
-   (i32.store
-    (i32.add
-     (get_local $9)
-     (i32.const 16)
-    )
-    (i32.const 0)
-   )
-   (i32.store
-    (i32.add
-     (get_local $9)
-     (i32.const 48)
-    )
-    (get_local $6)
-   )
-   (i64.store offset=24
-    (get_local $9)
-    (get_local $0)
-   )
-   (i32.store offset=40
-    (get_local $9)
-    (get_local $8)
-   )
-   (i64.store offset=8
-    (get_local $9)
-    (i64.const 0)
-   )
-   (i32.store offset=52
-    (get_local $9)
-    (i32.const 0)
-   )
-   (i32.store
-    (i32.add
-     (i32.add
-      (get_local $9)
-      (i32.const 24)
-     )
-     (i32.const 32)
-    )
-    (i32.const 0)
-   )
-   (i32.store
-    (i32.add
-     (i32.add
-      (get_local $9)
-      (i32.const 24)
-     )
-     (i32.const 36)
-    )
-    (i32.const 0)
-   )
-   (set_local $8
-    (i32.add
-     (tee_local $2
-      (select
-       (i32.load
-        (i32.add
-         (get_local $3)
-         (i32.const 36)
-        )
-       )
-       (i32.shr_u
-        (tee_local $8
-         (i32.load8_u offset=32
-          (get_local $3)
-         )
-        )
-        (i32.const 1)
-       )
-       (i32.and
-        (get_local $8)
-        (i32.const 1)
-       )
-      )
-     )
-     (i32.const 32)
-    )
-   )
-   (set_local $0
-    (i64.extend_u/i32
-     (get_local $2)
-    )
-   )
-   (set_local $2
-    (i32.add
-     (get_local $9)
-     (i32.const 52)
-    )
-   )
-   (loop $label$3
-    (set_local $8
-     (i32.add
-      (get_local $8)
-      (i32.const 1)
-     )
-    )
-    (br_if $label$3
-     (i64.ne
-      (tee_local $0
-       (i64.shr_u
-        (get_local $0)
-        (i64.const 7)
-       )
-      )
-      (i64.const 0)
-     )
-    )
-   )
-   (block $label$4
-    (block $label$5
-     (br_if $label$5
-      (i32.eqz
-       (get_local $8)
-      )
-     )
-     (call $_ZNSt3__16vectorIcNS_9allocatorIcEEE8__appendEj
-      (get_local $2)
-      (get_local $8)
-     )
-     (set_local $2
-      (i32.load
-       (i32.add
-        (get_local $9)
-        (i32.const 56)
-       )
-      )
-     )
-     (set_local $8
-      (i32.load
-       (i32.add
-        (get_local $9)
-        (i32.const 52)
-       )
-      )
-     )
-     (br $label$4)
-    )
-    (set_local $2
-     (i32.const 0)
-    )
-    (set_local $8
-     (i32.const 0)
-    )
-   )
-   (i32.store offset=84
-    (get_local $9)
-    (get_local $8)
-   )
-   (i32.store offset=80
-    (get_local $9)
-    (get_local $8)
-   )
-   (i32.store offset=88
-    (get_local $9)
-    (get_local $2)
-   )
-   (i32.store offset=64
-    (get_local $9)
-    (i32.add
-     (get_local $9)
-     (i32.const 80)
-    )
-   )
-   (i32.store offset=72
-    (get_local $9)
-    (get_local $3)
-   )
-   (call $_ZN5boost6fusion6detail17for_each_unrolledILi4EE4callINS0_18std_tuple_iteratorIKNSt3__15tupleIJyyN5eosio5assetENS6_12basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEEEELi0EEEZNS8_lsINS8_10datastreamIPcEEJyyS9_SF_EEERT_SO_RKNS7_IJDpT0_EEEEUlRKSN_E_EEvSV_RKT0_
-    (i32.add
-     (get_local $9)
-     (i32.const 72)
-    )
-    (i32.add
-     (get_local $9)
-     (i32.const 64)
-    )
-   )
-   (call $_ZN5eosio4packINS_6actionEEENSt3__16vectorIcNS2_9allocatorIcEEEERKT_
-    (i32.add
-     (get_local $9)
-     (i32.const 80)
-    )
-    (i32.add
-     (get_local $9)
-     (i32.const 24)
-    )
-   )
-   (call $send_inline
-    (tee_local $8
-     (i32.load offset=80
-      (get_local $9)
-     )
-    )
-    (i32.sub
-     (i32.load offset=84
-      (get_local $9)
-     )
-     (get_local $8)
-    )
-   )
-   (block $label$6
-    (br_if $label$6
-     (i32.eqz
-      (tee_local $8
-       (i32.load offset=80
-        (get_local $9)
-       )
-      )
-     )
-    )
-    (i32.store offset=84
-     (get_local $9)
-     (get_local $8)
-    )
-    (call $_ZdlPv
-     (get_local $8)
-    )
-   )
-   (block $label$7
-    (br_if $label$7
-     (i32.eqz
-      (tee_local $8
-       (i32.load offset=52
-        (get_local $9)
-       )
-      )
-     )
-    )
-    (i32.store
-     (i32.add
-      (get_local $9)
-      (i32.const 56)
-     )
-     (get_local $8)
-    )
-    (call $_ZdlPv
-     (get_local $8)
-    )
-   )
-   (block $label$8
-    (br_if $label$8
-     (i32.eqz
-      (tee_local $8
-       (i32.load offset=40
-        (get_local $9)
-       )
-      )
-     )
-    )
-    (i32.store
-     (i32.add
-      (get_local $9)
-      (i32.const 44)
-     )
-     (get_local $8)
-    )
-    (call $_ZdlPv
-     (get_local $8)
-    )
-   )
-   (block $label$9
-    (br_if $label$9
-     (i32.eqz
-      (tee_local $8
-       (i32.load offset=8
-        (get_local $9)
-       )
-      )
-     )
-    )
-    (i32.store offset=12
-     (get_local $9)
-     (get_local $8)
-    )
-    (call $_ZdlPv
-     (get_local $8)
-    )
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (i32.add
-     (get_local $9)
-     (i32.const 96)
-    )
-   )
-   (return)
-  )
-  (call $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv
-   (i32.add
-    (get_local $9)
-    (i32.const 8)
-   )
-  )
-  (unreachable)
- )
- (func $_ZNSt3__16vectorIcNS_9allocatorIcEEE8__appendEj (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (block $label$4
-       (br_if $label$4
-        (i32.ge_u
-         (i32.sub
-          (tee_local $2
-           (i32.load offset=8
-            (get_local $0)
-           )
-          )
-          (tee_local $6
-           (i32.load offset=4
-            (get_local $0)
-           )
-          )
-         )
-         (get_local $1)
-        )
-       )
-       (br_if $label$2
-        (i32.le_s
-         (tee_local $4
-          (i32.add
-           (tee_local $3
-            (i32.sub
-             (get_local $6)
-             (tee_local $5
-              (i32.load
-               (get_local $0)
-              )
-             )
-            )
-           )
-           (get_local $1)
-          )
-         )
-         (i32.const -1)
-        )
-       )
-       (set_local $6
-        (i32.const 2147483647)
-       )
-       (block $label$5
-        (br_if $label$5
-         (i32.gt_u
-          (tee_local $2
-           (i32.sub
-            (get_local $2)
-            (get_local $5)
-           )
-          )
-          (i32.const 1073741822)
-         )
-        )
-        (br_if $label$3
-         (i32.eqz
-          (tee_local $6
-           (select
-            (get_local $4)
-            (tee_local $6
-             (i32.shl
-              (get_local $2)
-              (i32.const 1)
-             )
-            )
-            (i32.lt_u
-             (get_local $6)
-             (get_local $4)
-            )
-           )
-          )
-         )
-        )
-       )
-       (set_local $2
-        (call $_Znwj
-         (get_local $6)
-        )
-       )
-       (br $label$1)
-      )
-      (set_local $0
-       (i32.add
-        (get_local $0)
-        (i32.const 4)
-       )
-      )
-      (loop $label$6
-       (i32.store8
-        (get_local $6)
-        (i32.const 0)
-       )
-       (i32.store
-        (get_local $0)
-        (tee_local $6
-         (i32.add
-          (i32.load
-           (get_local $0)
-          )
-          (i32.const 1)
-         )
-        )
-       )
-       (br_if $label$6
-        (tee_local $1
-         (i32.add
-          (get_local $1)
-          (i32.const -1)
-         )
-        )
-       )
-       (br $label$0)
-      )
-     )
-     (set_local $6
-      (i32.const 0)
-     )
-     (set_local $2
-      (i32.const 0)
-     )
-     (br $label$1)
-    )
-    (call $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv
-     (get_local $0)
-    )
-    (unreachable)
-   )
-   (set_local $4
-    (i32.add
-     (get_local $2)
-     (get_local $6)
-    )
-   )
-   (set_local $6
-    (tee_local $5
-     (i32.add
-      (get_local $2)
-      (get_local $3)
-     )
-    )
-   )
-   (loop $label$7
-    (i32.store8
-     (get_local $6)
-     (i32.const 0)
-    )
-    (set_local $6
-     (i32.add
-      (get_local $6)
-      (i32.const 1)
-     )
-    )
-    (br_if $label$7
-     (tee_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const -1)
-      )
-     )
-    )
-   )
-   (set_local $5
-    (i32.sub
-     (get_local $5)
-     (tee_local $2
-      (i32.sub
-       (i32.load
-        (tee_local $3
-         (i32.add
-          (get_local $0)
-          (i32.const 4)
-         )
-        )
-       )
-       (tee_local $1
-        (i32.load
-         (get_local $0)
-        )
-       )
-      )
-     )
-    )
-   )
-   (block $label$8
-    (br_if $label$8
-     (i32.lt_s
-      (get_local $2)
-      (i32.const 1)
-     )
-    )
-    (drop
-     (call $memcpy
-      (get_local $5)
-      (get_local $1)
-      (get_local $2)
-     )
-    )
-    (set_local $1
-     (i32.load
-      (get_local $0)
-     )
-    )
-   )
-   (i32.store
-    (get_local $0)
-    (get_local $5)
-   )
-   (i32.store
-    (get_local $3)
-    (get_local $6)
-   )
-   (i32.store
-    (i32.add
-     (get_local $0)
-     (i32.const 8)
-    )
-    (get_local $4)
-   )
-   (br_if $label$0
-    (i32.eqz
-     (get_local $1)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $1)
-   )
-   (return)
-  )
- )
- (func $_ZN5boost6fusion6detail17for_each_unrolledILi4EE4callINS0_18std_tuple_iteratorIKNSt3__15tupleIJyyN5eosio5assetENS6_12basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEEEELi0EEEZNS8_lsINS8_10datastreamIPcEEJyyS9_SF_EEERT_SO_RKNS7_IJDpT0_EEEEUlRKSN_E_EEvSV_RKT0_ (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (set_local $2
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $3
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $3)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (get_local $2)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (i32.add
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (set_local $0
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $3
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $3)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.add
-     (get_local $0)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (i32.add
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $3
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $3)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.add
-     (get_local $0)
-     (i32.const 16)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (tee_local $2
-    (i32.add
-     (i32.load offset=4
-      (get_local $3)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (get_local $3)
-     )
-     (get_local $2)
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.add
-     (get_local $0)
-     (i32.const 24)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (i32.add
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (drop
-   (call $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE
-    (i32.load
-     (get_local $1)
-    )
-    (i32.add
-     (get_local $0)
-     (i32.const 32)
-    )
-   )
-  )
- )
- (func $_ZN5eosio4packINS_6actionEEENSt3__16vectorIcNS2_9allocatorIcEEEERKT_ (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (local $8 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=8
-   (get_local $0)
-   (i32.const 0)
-  )
-  (i64.store align=4
-   (get_local $0)
-   (i64.const 0)
-  )
-  (set_local $5
-   (i32.const 16)
-  )
-  (set_local $2
-   (i32.add
-    (get_local $1)
-    (i32.const 16)
-   )
-  )
-  (set_local $6
-   (i64.extend_u/i32
-    (i32.shr_s
-     (tee_local $4
-      (i32.sub
-       (tee_local $7
-        (i32.load
-         (i32.add
-          (get_local $1)
-          (i32.const 20)
-         )
-        )
-       )
-       (tee_local $3
-        (i32.load offset=16
-         (get_local $1)
-        )
-       )
-      )
-     )
-     (i32.const 4)
-    )
-   )
-  )
-  (loop $label$0
-   (set_local $5
-    (i32.add
-     (get_local $5)
-     (i32.const 1)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $6
-      (i64.shr_u
-       (get_local $6)
-       (i64.const 7)
-      )
-     )
-     (i64.const 0)
-    )
-   )
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eq
-     (get_local $3)
-     (get_local $7)
-    )
-   )
-   (set_local $5
-    (i32.add
-     (i32.and
-      (get_local $4)
-      (i32.const -16)
-     )
-     (get_local $5)
-    )
-   )
-  )
-  (set_local $5
-   (i32.sub
-    (i32.sub
-     (tee_local $7
-      (i32.load offset=28
-       (get_local $1)
-      )
-     )
-     (get_local $5)
-    )
-    (tee_local $3
-     (i32.load
-      (i32.add
-       (get_local $1)
-       (i32.const 32)
-      )
-     )
-    )
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $1)
-    (i32.const 28)
-   )
-  )
-  (set_local $6
-   (i64.extend_u/i32
-    (i32.sub
-     (get_local $3)
-     (get_local $7)
-    )
-   )
-  )
-  (loop $label$2
-   (set_local $5
-    (i32.add
-     (get_local $5)
-     (i32.const -1)
-    )
-   )
-   (br_if $label$2
-    (i64.ne
-     (tee_local $6
-      (i64.shr_u
-       (get_local $6)
-       (i64.const 7)
-      )
-     )
-     (i64.const 0)
-    )
-   )
-  )
-  (set_local $7
-   (i32.const 0)
-  )
-  (block $label$3
-   (block $label$4
-    (br_if $label$4
-     (i32.eqz
-      (get_local $5)
-     )
-    )
-    (call $_ZNSt3__16vectorIcNS_9allocatorIcEEE8__appendEj
-     (get_local $0)
-     (i32.sub
-      (i32.const 0)
-      (get_local $5)
-     )
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $5
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (br $label$3)
-   )
-   (set_local $5
-    (i32.const 0)
-   )
-  )
-  (i32.store
-   (get_local $8)
-   (get_local $5)
-  )
-  (i32.store offset=8
-   (get_local $8)
-   (get_local $7)
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (get_local $7)
-     (get_local $5)
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (get_local $5)
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (get_local $7)
-     (tee_local $0
-      (i32.add
-       (get_local $5)
-       (i32.const 8)
-      )
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (get_local $0)
-    (i32.add
-     (get_local $1)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $8)
-   (i32.add
-    (get_local $5)
-    (i32.const 16)
-   )
-  )
-  (drop
-   (call $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__16vectorIcNS6_9allocatorIcEEEE
-    (call $_ZN5eosiolsINS_10datastreamIPcEENS_16permission_levelEEERT_S6_RKNSt3__16vectorIT0_NS7_9allocatorIS9_EEEE
-     (get_local $8)
-     (get_local $2)
-    )
-    (get_local $4)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 16)
-   )
-  )
- )
- (func $_ZN5eosiolsINS_10datastreamIPcEENS_16permission_levelEEERT_S6_RKNSt3__16vectorIT0_NS7_9allocatorIS9_EEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $7
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (set_local $4
-   (i64.extend_u/i32
-    (i32.shr_s
-     (i32.sub
-      (i32.load offset=4
-       (get_local $1)
-      )
-      (i32.load
-       (get_local $1)
-      )
-     )
-     (i32.const 4)
-    )
-   )
-  )
-  (set_local $5
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (set_local $2
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (loop $label$0
-   (set_local $3
-    (i32.wrap/i64
-     (get_local $4)
-    )
-   )
-   (i32.store8 offset=15
-    (get_local $7)
-    (i32.or
-     (i32.shl
-      (tee_local $6
-       (i64.ne
-        (tee_local $4
-         (i64.shr_u
-          (get_local $4)
-          (i64.const 7)
-         )
-        )
-        (i64.const 0)
-       )
-      )
-      (i32.const 7)
-     )
-     (i32.and
-      (get_local $3)
-      (i32.const 127)
-     )
-    )
-   )
-   (call $eosio_assert
-    (i32.gt_s
-     (i32.sub
-      (i32.load
-       (get_local $2)
-      )
-      (get_local $5)
-     )
-     (i32.const 0)
-    )
-    (i32.const 272)
-   )
-   (drop
-    (call $memcpy
-     (i32.load
-      (tee_local $3
-       (i32.add
-        (get_local $0)
-        (i32.const 4)
-       )
-      )
-     )
-     (i32.add
-      (get_local $7)
-      (i32.const 15)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store
-    (get_local $3)
-    (tee_local $5
-     (i32.add
-      (i32.load
-       (get_local $3)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (br_if $label$0
-    (get_local $6)
-   )
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eq
-     (tee_local $6
-      (i32.load
-       (get_local $1)
-      )
-     )
-     (tee_local $1
-      (i32.load
-       (i32.add
-        (get_local $1)
-        (i32.const 4)
-       )
-      )
-     )
-    )
-   )
-   (set_local $3
-    (i32.add
-     (get_local $0)
-     (i32.const 4)
-    )
-   )
-   (loop $label$2
-    (call $eosio_assert
-     (i32.gt_s
-      (i32.sub
-       (i32.load
-        (tee_local $2
-         (i32.add
-          (get_local $0)
-          (i32.const 8)
-         )
-        )
-       )
-       (get_local $5)
-      )
-      (i32.const 7)
-     )
-     (i32.const 272)
-    )
-    (drop
-     (call $memcpy
-      (i32.load
-       (get_local $3)
-      )
-      (get_local $6)
-      (i32.const 8)
-     )
-    )
-    (i32.store
-     (get_local $3)
-     (tee_local $5
-      (i32.add
-       (i32.load
-        (get_local $3)
-       )
-       (i32.const 8)
-      )
-     )
-    )
-    (call $eosio_assert
-     (i32.gt_s
-      (i32.sub
-       (i32.load
-        (get_local $2)
-       )
-       (get_local $5)
-      )
-      (i32.const 7)
-     )
-     (i32.const 272)
-    )
-    (drop
-     (call $memcpy
-      (i32.load
-       (get_local $3)
-      )
-      (i32.add
-       (get_local $6)
-       (i32.const 8)
-      )
-      (i32.const 8)
-     )
-    )
-    (i32.store
-     (get_local $3)
-     (tee_local $5
-      (i32.add
-       (i32.load
-        (get_local $3)
-       )
-       (i32.const 8)
-      )
-     )
-    )
-    (br_if $label$2
-     (i32.ne
-      (tee_local $6
-       (i32.add
-        (get_local $6)
-        (i32.const 16)
-       )
-      )
-      (get_local $1)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $7)
-    (i32.const 16)
-   )
-  )
-  (get_local $0)
- )
- (func $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__16vectorIcNS6_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (set_local $7
-   (i64.extend_u/i32
-    (i32.sub
-     (i32.load offset=4
-      (get_local $1)
-     )
-     (i32.load
-      (get_local $1)
-     )
-    )
-   )
-  )
-  (set_local $6
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-  )
-  (loop $label$0
-   (set_local $2
-    (i32.wrap/i64
-     (get_local $7)
-    )
-   )
-   (i32.store8 offset=15
-    (get_local $8)
-    (i32.or
-     (i32.shl
-      (tee_local $3
-       (i64.ne
-        (tee_local $7
-         (i64.shr_u
-          (get_local $7)
-          (i64.const 7)
-         )
-        )
-        (i64.const 0)
-       )
-      )
-      (i32.const 7)
-     )
-     (i32.and
-      (get_local $2)
-      (i32.const 127)
-     )
-    )
-   )
-   (call $eosio_assert
-    (i32.gt_s
-     (i32.sub
-      (i32.load
-       (get_local $4)
-      )
-      (get_local $6)
-     )
-     (i32.const 0)
-    )
-    (i32.const 272)
-   )
-   (drop
-    (call $memcpy
-     (i32.load
-      (get_local $5)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 15)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store
-    (get_local $5)
-    (tee_local $6
-     (i32.add
-      (i32.load
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (br_if $label$0
-    (get_local $3)
-   )
-  )
-  (call $eosio_assert
-   (i32.ge_s
-    (i32.sub
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 8)
-      )
-     )
-     (get_local $6)
-    )
-    (tee_local $5
-     (i32.sub
-      (i32.load
-       (i32.add
-        (get_local $1)
-        (i32.const 4)
-       )
-      )
-      (tee_local $2
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-    )
-   )
-   (i32.const 272)
-  )
-  (drop
-   (call $memcpy
-    (i32.load
-     (tee_local $6
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (get_local $2)
-    (get_local $5)
-   )
-  )
-  (i32.store
-   (get_local $6)
-   (i32.add
-    (i32.load
-     (get_local $6)
-    )
-    (get_local $5)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 16)
-   )
-  )
-  (get_local $0)
- )
- (func $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (set_local $7
-   (i64.extend_u/i32
-    (select
-     (i32.load offset=4
-      (get_local $1)
-     )
-     (i32.shr_u
-      (tee_local $5
-       (i32.load8_u
-        (get_local $1)
-       )
-      )
-      (i32.const 1)
-     )
-     (i32.and
-      (get_local $5)
-      (i32.const 1)
-     )
-    )
-   )
-  )
-  (set_local $6
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-  )
-  (loop $label$0
-   (set_local $2
-    (i32.wrap/i64
-     (get_local $7)
-    )
-   )
-   (i32.store8 offset=15
-    (get_local $8)
-    (i32.or
-     (i32.shl
-      (tee_local $3
-       (i64.ne
-        (tee_local $7
-         (i64.shr_u
-          (get_local $7)
-          (i64.const 7)
-         )
-        )
-        (i64.const 0)
-       )
-      )
-      (i32.const 7)
-     )
-     (i32.and
-      (get_local $2)
-      (i32.const 127)
-     )
-    )
-   )
-   (call $eosio_assert
-    (i32.gt_s
-     (i32.sub
-      (i32.load
-       (get_local $4)
-      )
-      (get_local $6)
-     )
-     (i32.const 0)
-    )
-    (i32.const 272)
-   )
-   (drop
-    (call $memcpy
-     (i32.load
-      (get_local $5)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 15)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store
-    (get_local $5)
-    (tee_local $6
-     (i32.add
-      (i32.load
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (br_if $label$0
-    (get_local $3)
-   )
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (tee_local $5
-      (select
-       (i32.load
-        (i32.add
-         (get_local $1)
-         (i32.const 4)
-        )
-       )
-       (i32.shr_u
-        (tee_local $5
-         (i32.load8_u
-          (get_local $1)
-         )
-        )
-        (i32.const 1)
-       )
-       (tee_local $2
-        (i32.and
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-      )
-     )
-    )
-   )
-   (set_local $3
-    (i32.load offset=8
-     (get_local $1)
-    )
-   )
-   (call $eosio_assert
-    (i32.ge_s
-     (i32.sub
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 8)
-       )
-      )
-      (get_local $6)
-     )
-     (get_local $5)
-    )
-    (i32.const 272)
-   )
-   (drop
-    (call $memcpy
-     (i32.load
-      (tee_local $6
-       (i32.add
-        (get_local $0)
-        (i32.const 4)
-       )
-      )
-     )
-     (select
-      (get_local $3)
-      (i32.add
-       (get_local $1)
-       (i32.const 1)
-      )
-      (get_local $2)
-     )
-     (get_local $5)
-    )
-   )
-   (i32.store
-    (get_local $6)
-    (i32.add
-     (i32.load
-      (get_local $6)
-     )
-     (get_local $5)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 16)
-   )
-  )
-  (get_local $0)
- )
- (func $_ZNK5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE31load_object_by_primary_iteratorEl (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i64)
-  (local $9 i32)
-  (local $10 i32)
-  (set_local $9
-   (tee_local $10
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 32)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $10)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eq
-     (tee_local $7
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 28)
-       )
-      )
-     )
-     (tee_local $3
-      (i32.load offset=24
-       (get_local $0)
-      )
-     )
-    )
-   )
-   (set_local $4
-    (i32.sub
-     (i32.const 0)
-     (get_local $3)
-    )
-   )
-   (set_local $6
-    (i32.add
-     (get_local $7)
-     (i32.const -24)
-    )
-   )
-   (loop $label$1
-    (br_if $label$0
-     (i32.eq
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const 16)
-       )
-      )
-      (get_local $1)
-     )
-    )
-    (set_local $7
-     (get_local $6)
-    )
-    (set_local $6
-     (tee_local $5
-      (i32.add
-       (get_local $6)
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$1
-     (i32.ne
-      (i32.add
-       (get_local $5)
-       (get_local $4)
-      )
-      (i32.const -24)
-     )
-    )
-   )
-  )
-  (block $label$2
-   (block $label$3
-    (br_if $label$3
-     (i32.eq
-      (get_local $7)
-      (get_local $3)
-     )
-    )
-    (set_local $5
-     (i32.load
-      (i32.add
-       (get_local $7)
-       (i32.const -24)
-      )
-     )
-    )
-    (br $label$2)
-   )
-   (call $eosio_assert
-    (i32.xor
-     (i32.shr_u
-      (tee_local $7
-       (call $db_get_i64
-        (get_local $1)
-        (i32.const 0)
-        (i32.const 0)
-       )
-      )
-      (i32.const 31)
-     )
-     (i32.const 1)
-    )
-    (i32.const 352)
-   )
-   (block $label$4
-    (block $label$5
-     (br_if $label$5
-      (i32.le_u
-       (get_local $7)
-       (i32.const 512)
-      )
-     )
-     (drop
-      (call $db_get_i64
-       (get_local $1)
-       (tee_local $3
-        (call $malloc
-         (get_local $7)
-        )
-       )
-       (get_local $7)
-      )
-     )
-     (call $free
-      (get_local $3)
-     )
-     (br $label$4)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $3
-      (i32.sub
-       (get_local $10)
-       (i32.and
-        (i32.add
-         (get_local $7)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-    (drop
-     (call $db_get_i64
-      (get_local $1)
-      (get_local $3)
-      (get_local $7)
-     )
-    )
-   )
-   (set_local $2
-    (i32.add
-     (get_local $0)
-     (i32.const 24)
-    )
-   )
-   (i64.store offset=8
-    (tee_local $5
-     (call $_Znwj
-      (i32.const 32)
-     )
-    )
-    (i64.const 1398362884)
-   )
-   (i64.store
-    (get_local $5)
-    (i64.const 0)
-   )
-   (call $eosio_assert
-    (i32.const 1)
-    (i32.const 288)
-   )
-   (set_local $10
-    (i32.add
-     (get_local $5)
-     (i32.const 8)
-    )
-   )
-   (set_local $8
-    (i64.const 5462355)
-   )
-   (set_local $6
-    (i32.const 0)
-   )
-   (block $label$6
-    (block $label$7
-     (loop $label$8
-      (br_if $label$7
-       (i32.gt_u
-        (i32.add
-         (i32.shl
-          (i32.wrap/i64
-           (get_local $8)
-          )
-          (i32.const 24)
-         )
-         (i32.const -1073741825)
-        )
-        (i32.const 452984830)
-       )
-      )
-      (block $label$9
-       (br_if $label$9
-        (i64.ne
-         (i64.and
-          (tee_local $8
-           (i64.shr_u
-            (get_local $8)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (loop $label$10
-        (br_if $label$7
-         (i64.ne
-          (i64.and
-           (tee_local $8
-            (i64.shr_u
-             (get_local $8)
-             (i64.const 8)
-            )
-           )
-           (i64.const 255)
-          )
-          (i64.const 0)
-         )
-        )
-        (br_if $label$10
-         (i32.lt_s
-          (tee_local $6
-           (i32.add
-            (get_local $6)
-            (i32.const 1)
-           )
-          )
-          (i32.const 7)
-         )
-        )
-       )
-      )
-      (set_local $4
-       (i32.const 1)
-      )
-      (br_if $label$8
-       (i32.lt_s
-        (tee_local $6
-         (i32.add
-          (get_local $6)
-          (i32.const 1)
-         )
-        )
-        (i32.const 7)
-       )
-      )
-      (br $label$6)
-     )
-    )
-    (set_local $4
-     (i32.const 0)
-    )
-   )
-   (call $eosio_assert
-    (get_local $4)
-    (i32.const 16)
-   )
-   (i32.store offset=16
-    (get_local $5)
-    (get_local $0)
-   )
-   (call $eosio_assert
-    (i32.gt_u
-     (get_local $7)
-     (i32.const 7)
-    )
-    (i32.const 384)
-   )
-   (drop
-    (call $memcpy
-     (get_local $5)
-     (get_local $3)
-     (i32.const 8)
-    )
-   )
-   (call $eosio_assert
-    (i32.ne
-     (i32.and
-      (get_local $7)
-      (i32.const -8)
-     )
-     (i32.const 8)
-    )
-    (i32.const 384)
-   )
-   (drop
-    (call $memcpy
-     (get_local $10)
-     (i32.add
-      (get_local $3)
-      (i32.const 8)
-     )
-     (i32.const 8)
-    )
-   )
-   (i32.store offset=20
-    (get_local $5)
-    (get_local $1)
-   )
-   (i32.store offset=24
-    (get_local $9)
-    (get_local $5)
-   )
-   (i64.store offset=16
-    (get_local $9)
-    (tee_local $8
-     (i64.shr_u
-      (i64.load
-       (i32.add
-        (get_local $5)
-        (i32.const 8)
-       )
-      )
-      (i64.const 8)
-     )
-    )
-   )
-   (i32.store offset=12
-    (get_local $9)
-    (tee_local $7
-     (i32.load offset=20
-      (get_local $5)
-     )
-    )
-   )
-   (block $label$11
-    (block $label$12
-     (br_if $label$12
-      (i32.ge_u
-       (tee_local $6
-        (i32.load
-         (tee_local $1
-          (i32.add
-           (get_local $0)
-           (i32.const 28)
-          )
-         )
-        )
-       )
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 32)
-        )
-       )
-      )
-     )
-     (i64.store offset=8
-      (get_local $6)
-      (get_local $8)
-     )
-     (i32.store offset=16
-      (get_local $6)
-      (get_local $7)
-     )
-     (i32.store offset=24
-      (get_local $9)
-      (i32.const 0)
-     )
-     (i32.store
-      (get_local $6)
-      (get_local $5)
-     )
-     (i32.store
-      (get_local $1)
-      (i32.add
-       (get_local $6)
-       (i32.const 24)
-      )
-     )
-     (br $label$11)
-    )
-    (call $_ZNSt3__16vectorIN5eosio11multi_indexILy3607749779137757184ENS1_5token7accountEJEE8item_ptrENS_9allocatorIS6_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS5_4itemENS_14default_deleteISC_EEEERyRlEEEvDpOT_
-     (get_local $2)
-     (i32.add
-      (get_local $9)
-      (i32.const 24)
-     )
-     (i32.add
-      (get_local $9)
-      (i32.const 16)
-     )
-     (i32.add
-      (get_local $9)
-      (i32.const 12)
-     )
-    )
-   )
-   (set_local $6
-    (i32.load offset=24
-     (get_local $9)
-    )
-   )
-   (i32.store offset=24
-    (get_local $9)
-    (i32.const 0)
-   )
-   (br_if $label$2
-    (i32.eqz
-     (get_local $6)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $6)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 32)
-   )
-  )
-  (get_local $5)
- )
- (func $_ZNSt3__16vectorIN5eosio11multi_indexILy3607749779137757184ENS1_5token7accountEJEE8item_ptrENS_9allocatorIS6_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS5_4itemENS_14default_deleteISC_EEEERyRlEEEvDpOT_ (param $0 i32) (param $1 i32) (param $2 i32) (param $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.ge_u
-      (tee_local $5
-       (i32.add
-        (tee_local $4
-         (i32.div_s
-          (i32.sub
-           (i32.load offset=4
-            (get_local $0)
-           )
-           (tee_local $6
-            (i32.load
-             (get_local $0)
-            )
-           )
-          )
-          (i32.const 24)
-         )
-        )
-        (i32.const 1)
-       )
-      )
-      (i32.const 178956971)
-     )
-    )
-    (set_local $7
-     (i32.const 178956970)
-    )
-    (block $label$2
-     (block $label$3
-      (br_if $label$3
-       (i32.gt_u
-        (tee_local $6
-         (i32.div_s
-          (i32.sub
-           (i32.load offset=8
-            (get_local $0)
-           )
-           (get_local $6)
-          )
-          (i32.const 24)
-         )
-        )
-        (i32.const 89478484)
-       )
-      )
-      (br_if $label$2
-       (i32.eqz
-        (tee_local $7
-         (select
-          (get_local $5)
-          (tee_local $7
-           (i32.shl
-            (get_local $6)
-            (i32.const 1)
-           )
-          )
-          (i32.lt_u
-           (get_local $7)
-           (get_local $5)
-          )
-         )
-        )
-       )
-      )
-     )
-     (set_local $6
-      (call $_Znwj
-       (i32.mul
-        (get_local $7)
-        (i32.const 24)
-       )
-      )
-     )
-     (br $label$0)
-    )
-    (set_local $7
-     (i32.const 0)
-    )
-    (set_local $6
-     (i32.const 0)
-    )
-    (br $label$0)
-   )
-   (call $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv
-    (get_local $0)
-   )
-   (unreachable)
-  )
-  (set_local $5
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (i32.store
-   (get_local $1)
-   (i32.const 0)
-  )
-  (i32.store
-   (tee_local $1
-    (i32.add
-     (get_local $6)
-     (i32.mul
-      (get_local $4)
-      (i32.const 24)
-     )
-    )
-   )
-   (get_local $5)
-  )
-  (i64.store offset=8
-   (get_local $1)
-   (i64.load
-    (get_local $2)
-   )
-  )
-  (i32.store offset=16
-   (get_local $1)
-   (i32.load
-    (get_local $3)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $6)
-    (i32.mul
-     (get_local $7)
-     (i32.const 24)
-    )
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $1)
-    (i32.const 24)
-   )
-  )
-  (block $label$4
-   (block $label$5
-    (br_if $label$5
-     (i32.eq
-      (tee_local $6
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 4)
-        )
-       )
-      )
-      (tee_local $7
-       (i32.load
-        (get_local $0)
-       )
-      )
-     )
-    )
-    (loop $label$6
-     (set_local $3
-      (i32.load
-       (tee_local $2
-        (i32.add
-         (get_local $6)
-         (i32.const -24)
-        )
-       )
-      )
-     )
-     (i32.store
-      (get_local $2)
-      (i32.const 0)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -24)
-      )
-      (get_local $3)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -8)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -8)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -12)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -12)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -16)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -16)
-       )
-      )
-     )
-     (set_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const -24)
-      )
-     )
-     (set_local $6
-      (get_local $2)
-     )
-     (br_if $label$6
-      (i32.ne
-       (get_local $7)
-       (get_local $2)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $6
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (br $label$4)
-   )
-   (set_local $6
-    (get_local $7)
-   )
-  )
-  (i32.store
-   (get_local $0)
-   (get_local $1)
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-   (get_local $5)
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-   (get_local $4)
-  )
-  (block $label$7
-   (br_if $label$7
-    (i32.eq
-     (get_local $7)
-     (get_local $6)
-    )
-   )
-   (loop $label$8
-    (set_local $1
-     (i32.load
-      (tee_local $7
-       (i32.add
-        (get_local $7)
-        (i32.const -24)
-       )
-      )
-     )
-    )
-    (i32.store
-     (get_local $7)
-     (i32.const 0)
-    )
-    (block $label$9
-     (br_if $label$9
-      (i32.eqz
-       (get_local $1)
-      )
-     )
-     (call $_ZdlPv
-      (get_local $1)
-     )
-    )
-    (br_if $label$8
-     (i32.ne
-      (get_local $6)
-      (get_local $7)
-     )
-    )
-   )
-  )
-  (block $label$10
-   (br_if $label$10
-    (i32.eqz
-     (get_local $6)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $6)
-   )
-  )
- )
- (func $_ZN5eosio5token8transferEyyNS_5assetENSt3__112basic_stringIcNS2_11char_traitsIcEENS2_9allocatorIcEEEE (type $FUNCSIG$vijjii) (param $0 i32) (param $1 i64) (param $2 i64) (param $3 i32) (param $4 i32)
-  (local $5 i64)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (local $9 i64)
-  (local $10 i32)
-  (local $11 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $11
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 112)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i64.ne
-    (get_local $1)
-    (get_local $2)
-   )
-   (i32.const 992)
-  )
-  (call $require_auth
-   (get_local $1)
-  )
-  (call $eosio_assert
-   (call $is_account
-    (get_local $2)
-   )
-   (i32.const 1024)
-  )
-  (set_local $5
-   (i64.load offset=8
-    (get_local $3)
-   )
-  )
-  (set_local $8
-   (i32.const 0)
-  )
-  (i32.store
-   (i32.add
-    (get_local $11)
-    (i32.const 104)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=80
-   (get_local $11)
-   (tee_local $9
-    (i64.shr_u
-     (get_local $5)
-     (i64.const 8)
-    )
-   )
-  )
-  (i64.store offset=88
-   (get_local $11)
-   (i64.const -1)
-  )
-  (i64.store offset=96
-   (get_local $11)
-   (i64.const 0)
-  )
-  (i64.store offset=72
-   (get_local $11)
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (set_local $6
-   (call $_ZNK5eosio11multi_indexILy14289235522390851584ENS_5token14currency_statsEJEE3getEyPKc
-    (i32.add
-     (get_local $11)
-     (i32.const 72)
-    )
-    (get_local $9)
-    (i32.const 1056)
-   )
-  )
-  (call $require_recipient
-   (get_local $1)
-  )
-  (call $require_recipient
-   (get_local $2)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i64.gt_u
-     (i64.add
-      (tee_local $7
-       (i64.load
-        (get_local $3)
-       )
-      )
-      (i64.const 4611686018427387903)
-     )
-     (i64.const 9223372036854775806)
-    )
-   )
-   (set_local $10
-    (i32.const 0)
-   )
-   (block $label$1
-    (loop $label$2
-     (br_if $label$1
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $9)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$3
-      (br_if $label$3
-       (i64.ne
-        (i64.and
-         (tee_local $9
-          (i64.shr_u
-           (get_local $9)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$4
-       (br_if $label$1
-        (i64.ne
-         (i64.and
-          (tee_local $9
-           (i64.shr_u
-            (get_local $9)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$4
-        (i32.lt_s
-         (tee_local $10
-          (i32.add
-           (get_local $10)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $8
-      (i32.const 1)
-     )
-     (br_if $label$2
-      (i32.lt_s
-       (tee_local $10
-        (i32.add
-         (get_local $10)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$0)
-    )
-   )
-   (set_local $8
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $8)
-   (i32.const 496)
-  )
-  (call $eosio_assert
-   (i64.gt_s
-    (get_local $7)
-    (i64.const 0)
-   )
-   (i32.const 1088)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (get_local $5)
-    (i64.load offset=8
-     (get_local $6)
-    )
-   )
-   (i32.const 560)
-  )
-  (block $label$5
-   (block $label$6
-    (br_if $label$6
-     (i32.and
-      (tee_local $10
-       (i32.load8_u
-        (get_local $4)
-       )
-      )
-      (i32.const 1)
-     )
-    )
-    (set_local $10
-     (i32.shr_u
-      (get_local $10)
-      (i32.const 1)
-     )
-    )
-    (br $label$5)
-   )
-   (set_local $10
-    (i32.load offset=4
-     (get_local $4)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.lt_u
-    (get_local $10)
-    (i32.const 257)
-   )
-   (i32.const 400)
-  )
-  (i64.store
-   (tee_local $10
-    (i32.add
-     (i32.add
-      (get_local $11)
-      (i32.const 56)
-     )
-     (i32.const 8)
-    )
-   )
-   (i64.load
-    (tee_local $8
-     (i32.add
-      (get_local $3)
-      (i32.const 8)
-     )
-    )
-   )
-  )
-  (set_local $9
-   (i64.load
-    (get_local $3)
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $11)
-     (i32.const 24)
-    )
-    (i32.const 12)
-   )
-   (i32.load
-    (i32.add
-     (i32.add
-      (get_local $11)
-      (i32.const 56)
-     )
-     (i32.const 12)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $11)
-     (i32.const 24)
-    )
-    (i32.const 8)
-   )
-   (i32.load
-    (get_local $10)
-   )
-  )
-  (i64.store offset=56
-   (get_local $11)
-   (get_local $9)
-  )
-  (i32.store offset=28
-   (get_local $11)
-   (i32.load offset=60
-    (get_local $11)
-   )
-  )
-  (i32.store offset=24
-   (get_local $11)
-   (i32.load offset=56
-    (get_local $11)
-   )
-  )
-  (call $_ZN5eosio5token11sub_balanceEyNS_5assetE
-   (get_local $0)
-   (get_local $1)
-   (i32.add
-    (get_local $11)
-    (i32.const 24)
-   )
-  )
-  (i64.store
-   (tee_local $10
-    (i32.add
-     (i32.add
-      (get_local $11)
-      (i32.const 40)
-     )
-     (i32.const 8)
-    )
-   )
-   (i64.load
-    (get_local $8)
-   )
-  )
-  (set_local $9
-   (i64.load
-    (get_local $3)
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $11)
-     (i32.const 8)
-    )
-    (i32.const 12)
-   )
-   (i32.load
-    (i32.add
-     (i32.add
-      (get_local $11)
-      (i32.const 40)
-     )
-     (i32.const 12)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $11)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-   (i32.load
-    (get_local $10)
-   )
-  )
-  (i64.store offset=40
-   (get_local $11)
-   (get_local $9)
-  )
-  (i32.store offset=12
-   (get_local $11)
-   (i32.load offset=44
-    (get_local $11)
-   )
-  )
-  (i32.store offset=8
-   (get_local $11)
-   (i32.load offset=40
-    (get_local $11)
-   )
-  )
-  (call $_ZN5eosio5token11add_balanceEyNS_5assetEy
-   (get_local $0)
-   (get_local $2)
-   (i32.add
-    (get_local $11)
-    (i32.const 8)
-   )
-   (get_local $1)
-  )
-  (block $label$7
-   (br_if $label$7
-    (i32.eqz
-     (tee_local $8
-      (i32.load offset=96
-       (get_local $11)
-      )
-     )
-    )
-   )
-   (block $label$8
-    (block $label$9
-     (br_if $label$9
-      (i32.eq
-       (tee_local $10
-        (i32.load
-         (tee_local $0
-          (i32.add
-           (get_local $11)
-           (i32.const 100)
-          )
-         )
-        )
-       )
-       (get_local $8)
-      )
-     )
-     (loop $label$10
-      (set_local $3
-       (i32.load
-        (tee_local $10
-         (i32.add
-          (get_local $10)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $10)
-       (i32.const 0)
-      )
-      (block $label$11
-       (br_if $label$11
-        (i32.eqz
-         (get_local $3)
-        )
-       )
-       (call $_ZdlPv
-        (get_local $3)
-       )
-      )
-      (br_if $label$10
-       (i32.ne
-        (get_local $8)
-        (get_local $10)
-       )
-      )
-     )
-     (set_local $10
-      (i32.load
-       (i32.add
-        (get_local $11)
-        (i32.const 96)
-       )
-      )
-     )
-     (br $label$8)
-    )
-    (set_local $10
-     (get_local $8)
-    )
-   )
-   (i32.store
-    (get_local $0)
-    (get_local $8)
-   )
-   (call $_ZdlPv
-    (get_local $10)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $11)
-    (i32.const 112)
-   )
-  )
- )
- (func $_ZNK5eosio11multi_indexILy14289235522390851584ENS_5token14currency_statsEJEE3getEyPKc (param $0 i32) (param $1 i64) (param $2 i32) (result i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.eq
-     (tee_local $7
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 28)
-       )
-      )
-     )
-     (tee_local $3
-      (i32.load offset=24
-       (get_local $0)
-      )
-     )
-    )
-   )
-   (set_local $6
-    (i32.add
-     (get_local $7)
-     (i32.const -24)
-    )
-   )
-   (set_local $4
-    (i32.sub
-     (i32.const 0)
-     (get_local $3)
-    )
-   )
-   (loop $label$1
-    (br_if $label$0
-     (i64.eq
-      (i64.shr_u
-       (i64.load offset=8
-        (i32.load
-         (get_local $6)
-        )
-       )
-       (i64.const 8)
-      )
-      (get_local $1)
-     )
-    )
-    (set_local $7
-     (get_local $6)
-    )
-    (set_local $6
-     (tee_local $5
-      (i32.add
-       (get_local $6)
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$1
-     (i32.ne
-      (i32.add
-       (get_local $5)
-       (get_local $4)
-      )
-      (i32.const -24)
-     )
-    )
-   )
-  )
-  (block $label$2
-   (block $label$3
-    (br_if $label$3
-     (i32.eq
-      (get_local $7)
-      (get_local $3)
-     )
-    )
-    (call $eosio_assert
-     (i32.eq
-      (i32.load offset=40
-       (tee_local $6
-        (i32.load
-         (i32.add
-          (get_local $7)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (get_local $0)
-     )
-     (i32.const 96)
-    )
-    (br $label$2)
-   )
-   (set_local $6
-    (i32.const 0)
-   )
-   (br_if $label$2
-    (i32.lt_s
-     (tee_local $5
-      (call $db_find_i64
-       (i64.load
-        (get_local $0)
-       )
-       (i64.load offset=8
-        (get_local $0)
-       )
-       (i64.const -4157508551318700032)
-       (get_local $1)
-      )
-     )
-     (i32.const 0)
-    )
-   )
-   (call $eosio_assert
-    (i32.eq
-     (i32.load offset=40
-      (tee_local $6
-       (call $_ZNK5eosio11multi_indexILy14289235522390851584ENS_5token14currency_statsEJEE31load_object_by_primary_iteratorEl
-        (get_local $0)
-        (get_local $5)
-       )
-      )
-     )
-     (get_local $0)
-    )
-    (i32.const 96)
-   )
-  )
-  (call $eosio_assert
-   (i32.ne
-    (get_local $6)
-    (i32.const 0)
-   )
-   (get_local $2)
-  )
-  (get_local $6)
- )
- (func $_ZN5eosio5token11sub_balanceEyNS_5assetE (param $0 i32) (param $1 i64) (param $2 i32)
-  (local $3 i64)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (local $8 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 64)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $8)
-    (i32.const 40)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=16
-   (get_local $8)
-   (get_local $1)
-  )
-  (i64.store offset=24
-   (get_local $8)
-   (i64.const -1)
-  )
-  (i64.store offset=32
-   (get_local $8)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $8)
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i64.ge_s
-    (i64.load
-     (tee_local $0
-      (call $_ZNK5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE3getEyPKc
-       (i32.add
-        (get_local $8)
-        (i32.const 8)
-       )
-       (i64.shr_u
-        (tee_local $3
-         (i64.load offset=8
-          (get_local $2)
-         )
-        )
-        (i64.const 8)
-       )
-       (i32.const 1120)
-      )
-     )
-    )
-    (tee_local $4
-     (i64.load
-      (get_local $2)
-     )
-    )
-   )
-   (i32.const 1152)
-  )
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i64.ne
-       (get_local $4)
-       (i64.load
-        (get_local $0)
-       )
-      )
-     )
-     (call $_ZN5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE5eraseERKS2_
-      (i32.add
-       (get_local $8)
-       (i32.const 8)
-      )
-      (get_local $0)
-     )
-     (br_if $label$1
-      (tee_local $5
-       (i32.load offset=32
-        (get_local $8)
-       )
-      )
-     )
-     (br $label$0)
-    )
-    (call $eosio_assert
-     (i32.eq
-      (i32.load offset=16
-       (get_local $0)
-      )
-      (i32.add
-       (get_local $8)
-       (i32.const 8)
-      )
-     )
-     (i32.const 640)
-    )
-    (call $eosio_assert
-     (i64.eq
-      (i64.load offset=8
-       (get_local $8)
-      )
-      (call $current_receiver)
-     )
-     (i32.const 688)
-    )
-    (call $eosio_assert
-     (i64.eq
-      (get_local $3)
-      (tee_local $6
-       (i64.load offset=8
-        (get_local $0)
-       )
-      )
-     )
-     (i32.const 1184)
-    )
-    (i64.store
-     (get_local $0)
-     (tee_local $4
-      (i64.sub
-       (i64.load
-        (get_local $0)
-       )
-       (get_local $4)
-      )
-     )
-    )
-    (call $eosio_assert
-     (i64.gt_s
-      (get_local $4)
-      (i64.const -4611686018427387904)
-     )
-     (i32.const 1232)
-    )
-    (call $eosio_assert
-     (i64.lt_s
-      (i64.load
-       (get_local $0)
-      )
-      (i64.const 4611686018427387904)
-     )
-     (i32.const 1264)
-    )
-    (call $eosio_assert
-     (i64.eq
-      (tee_local $4
-       (i64.shr_u
-        (get_local $6)
-        (i64.const 8)
-       )
-      )
-      (i64.shr_u
-       (i64.load offset=8
-        (get_local $0)
-       )
-       (i64.const 8)
-      )
-     )
-     (i32.const 864)
-    )
-    (call $eosio_assert
-     (i32.const 1)
-     (i32.const 272)
-    )
-    (drop
-     (call $memcpy
-      (i32.add
-       (get_local $8)
-       (i32.const 48)
-      )
-      (get_local $0)
-      (i32.const 8)
-     )
-    )
-    (call $eosio_assert
-     (i32.const 1)
-     (i32.const 272)
-    )
-    (drop
-     (call $memcpy
-      (i32.or
-       (i32.add
-        (get_local $8)
-        (i32.const 48)
-       )
-       (i32.const 8)
-      )
-      (i32.add
-       (get_local $0)
-       (i32.const 8)
-      )
-      (i32.const 8)
-     )
-    )
-    (call $db_update_i64
-     (i32.load offset=20
-      (get_local $0)
-     )
-     (get_local $1)
-     (i32.add
-      (get_local $8)
-      (i32.const 48)
-     )
-     (i32.const 16)
-    )
-    (block $label$3
-     (br_if $label$3
-      (i64.lt_u
-       (get_local $4)
-       (i64.load
-        (tee_local $0
-         (i32.add
-          (i32.add
-           (get_local $8)
-           (i32.const 8)
-          )
-          (i32.const 16)
-         )
-        )
-       )
-      )
-     )
-     (i64.store
-      (get_local $0)
-      (i64.add
-       (get_local $4)
-       (i64.const 1)
-      )
-     )
-    )
-    (br_if $label$0
-     (i32.eqz
-      (tee_local $5
-       (i32.load offset=32
-        (get_local $8)
-       )
-      )
-     )
-    )
-   )
-   (block $label$4
-    (block $label$5
-     (br_if $label$5
-      (i32.eq
-       (tee_local $0
-        (i32.load
-         (tee_local $7
-          (i32.add
-           (get_local $8)
-           (i32.const 36)
-          )
-         )
-        )
-       )
-       (get_local $5)
-      )
-     )
-     (loop $label$6
-      (set_local $2
-       (i32.load
-        (tee_local $0
-         (i32.add
-          (get_local $0)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $0)
-       (i32.const 0)
-      )
-      (block $label$7
-       (br_if $label$7
-        (i32.eqz
-         (get_local $2)
-        )
-       )
-       (call $_ZdlPv
-        (get_local $2)
-       )
-      )
-      (br_if $label$6
-       (i32.ne
-        (get_local $5)
-        (get_local $0)
-       )
-      )
-     )
-     (set_local $0
-      (i32.load
-       (i32.add
-        (get_local $8)
-        (i32.const 32)
-       )
-      )
-     )
-     (br $label$4)
-    )
-    (set_local $0
-     (get_local $5)
-    )
-   )
-   (i32.store
-    (get_local $7)
-    (get_local $5)
-   )
-   (call $_ZdlPv
-    (get_local $0)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 64)
-   )
-  )
- )
- (func $_ZNK5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE3getEyPKc (param $0 i32) (param $1 i64) (param $2 i32) (result i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.eq
-     (tee_local $7
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 28)
-       )
-      )
-     )
-     (tee_local $3
-      (i32.load offset=24
-       (get_local $0)
-      )
-     )
-    )
-   )
-   (set_local $6
-    (i32.add
-     (get_local $7)
-     (i32.const -24)
-    )
-   )
-   (set_local $4
-    (i32.sub
-     (i32.const 0)
-     (get_local $3)
-    )
-   )
-   (loop $label$1
-    (br_if $label$0
-     (i64.eq
-      (i64.shr_u
-       (i64.load offset=8
-        (i32.load
-         (get_local $6)
-        )
-       )
-       (i64.const 8)
-      )
-      (get_local $1)
-     )
-    )
-    (set_local $7
-     (get_local $6)
-    )
-    (set_local $6
-     (tee_local $5
-      (i32.add
-       (get_local $6)
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$1
-     (i32.ne
-      (i32.add
-       (get_local $5)
-       (get_local $4)
-      )
-      (i32.const -24)
-     )
-    )
-   )
-  )
-  (block $label$2
-   (block $label$3
-    (br_if $label$3
-     (i32.eq
-      (get_local $7)
-      (get_local $3)
-     )
-    )
-    (call $eosio_assert
-     (i32.eq
-      (i32.load offset=16
-       (tee_local $6
-        (i32.load
-         (i32.add
-          (get_local $7)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (get_local $0)
-     )
-     (i32.const 96)
-    )
-    (br $label$2)
-   )
-   (set_local $6
-    (i32.const 0)
-   )
-   (br_if $label$2
-    (i32.lt_s
-     (tee_local $5
-      (call $db_find_i64
-       (i64.load
-        (get_local $0)
-       )
-       (i64.load offset=8
-        (get_local $0)
-       )
-       (i64.const 3607749779137757184)
-       (get_local $1)
-      )
-     )
-     (i32.const 0)
-    )
-   )
-   (call $eosio_assert
-    (i32.eq
-     (i32.load offset=16
-      (tee_local $6
-       (call $_ZNK5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE31load_object_by_primary_iteratorEl
-        (get_local $0)
-        (get_local $5)
-       )
-      )
-     )
-     (get_local $0)
-    )
-    (i32.const 96)
-   )
-  )
-  (call $eosio_assert
-   (i32.ne
-    (get_local $6)
-    (i32.const 0)
-   )
-   (get_local $2)
-  )
-  (get_local $6)
- )
- (func $_ZN5eosio11multi_indexILy3607749779137757184ENS_5token7accountEJEE5eraseERKS2_ (param $0 i32) (param $1 i32)
-  (local $2 i64)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (call $eosio_assert
-   (i32.eq
-    (i32.load offset=16
-     (get_local $1)
-    )
-    (get_local $0)
-   )
-   (i32.const 1296)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (i64.load
-     (get_local $0)
-    )
-    (call $current_receiver)
-   )
-   (i32.const 1344)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eq
-     (tee_local $7
-      (i32.load
-       (tee_local $5
-        (i32.add
-         (get_local $0)
-         (i32.const 28)
-        )
-       )
-      )
-     )
-     (tee_local $3
-      (i32.load offset=24
-       (get_local $0)
-      )
-     )
-    )
-   )
-   (set_local $2
-    (i64.load offset=8
-     (get_local $1)
-    )
-   )
-   (set_local $6
-    (i32.sub
-     (i32.const 0)
-     (get_local $3)
-    )
-   )
-   (set_local $8
-    (i32.add
-     (get_local $7)
-     (i32.const -24)
-    )
-   )
-   (loop $label$1
-    (br_if $label$0
-     (i64.lt_u
-      (i64.xor
-       (i64.load offset=8
-        (i32.load
-         (get_local $8)
-        )
-       )
-       (get_local $2)
-      )
-      (i64.const 256)
-     )
-    )
-    (set_local $7
-     (get_local $8)
-    )
-    (set_local $8
-     (tee_local $4
-      (i32.add
-       (get_local $8)
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$1
-     (i32.ne
-      (i32.add
-       (get_local $4)
-       (get_local $6)
-      )
-      (i32.const -24)
-     )
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.ne
-    (get_local $7)
-    (get_local $3)
-   )
-   (i32.const 1408)
-  )
-  (set_local $8
-   (i32.add
-    (get_local $7)
-    (i32.const -24)
-   )
-  )
-  (block $label$2
-   (block $label$3
-    (br_if $label$3
-     (i32.eq
-      (get_local $7)
-      (tee_local $4
-       (i32.load
-        (get_local $5)
-       )
-      )
-     )
-    )
-    (set_local $3
-     (i32.sub
-      (i32.const 0)
-      (get_local $4)
-     )
-    )
-    (set_local $7
-     (get_local $8)
-    )
-    (loop $label$4
-     (set_local $6
-      (i32.load
-       (tee_local $8
-        (i32.add
-         (get_local $7)
-         (i32.const 24)
-        )
-       )
-      )
-     )
-     (i32.store
-      (get_local $8)
-      (i32.const 0)
-     )
-     (set_local $4
-      (i32.load
-       (get_local $7)
-      )
-     )
-     (i32.store
-      (get_local $7)
-      (get_local $6)
-     )
-     (block $label$5
-      (br_if $label$5
-       (i32.eqz
-        (get_local $4)
-       )
-      )
-      (call $_ZdlPv
-       (get_local $4)
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $7)
-       (i32.const 16)
-      )
-      (i32.load
-       (i32.add
-        (get_local $7)
-        (i32.const 40)
-       )
-      )
-     )
-     (i64.store
-      (i32.add
-       (get_local $7)
-       (i32.const 8)
-      )
-      (i64.load
-       (i32.add
-        (get_local $7)
-        (i32.const 32)
-       )
-      )
-     )
-     (set_local $7
-      (get_local $8)
-     )
-     (br_if $label$4
-      (i32.ne
-       (i32.add
-        (get_local $8)
-        (get_local $3)
-       )
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$2
-     (i32.eq
-      (tee_local $7
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 28)
-        )
-       )
-      )
-      (get_local $8)
-     )
-    )
-   )
-   (loop $label$6
-    (set_local $4
-     (i32.load
-      (tee_local $7
-       (i32.add
-        (get_local $7)
-        (i32.const -24)
-       )
-      )
-     )
-    )
-    (i32.store
-     (get_local $7)
-     (i32.const 0)
-    )
-    (block $label$7
-     (br_if $label$7
-      (i32.eqz
-       (get_local $4)
-      )
-     )
-     (call $_ZdlPv
-      (get_local $4)
-     )
-    )
-    (br_if $label$6
-     (i32.ne
-      (get_local $8)
-      (get_local $7)
-     )
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 28)
-   )
-   (get_local $8)
-  )
-  (call $db_remove_i64
-   (i32.load offset=20
-    (get_local $1)
-   )
-  )
- )
- (func $apply (param $0 i64) (param $1 i64) (param $2 i64)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i64)
-  (local $6 i64)
-  (local $7 i64)
-  (local $8 i64)
-  (local $9 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 64)
-    )
-   )
-  )
-  (set_local $6
-   (i64.const 0)
-  )
-  (set_local $5
-   (i64.const 59)
-  )
-  (set_local $4
-   (i32.const 1472)
-  )
-  (set_local $7
-   (i64.const 0)
-  )
-  (loop $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (block $label$4
-       (block $label$5
-        (br_if $label$5
-         (i64.gt_u
-          (get_local $6)
-          (i64.const 6)
-         )
-        )
-        (br_if $label$4
-         (i32.gt_u
-          (i32.and
-           (i32.add
-            (tee_local $3
-             (i32.load8_s
-              (get_local $4)
-             )
-            )
-            (i32.const -97)
-           )
-           (i32.const 255)
-          )
-          (i32.const 25)
-         )
-        )
-        (set_local $3
-         (i32.add
-          (get_local $3)
-          (i32.const 165)
-         )
-        )
-        (br $label$3)
-       )
-       (set_local $8
-        (i64.const 0)
-       )
-       (br_if $label$2
-        (i64.le_u
-         (get_local $6)
-         (i64.const 11)
-        )
-       )
-       (br $label$1)
-      )
-      (set_local $3
-       (select
-        (i32.add
-         (get_local $3)
-         (i32.const 208)
-        )
-        (i32.const 0)
-        (i32.lt_u
-         (i32.and
-          (i32.add
-           (get_local $3)
-           (i32.const -49)
-          )
-          (i32.const 255)
-         )
-         (i32.const 5)
-        )
-       )
-      )
-     )
-     (set_local $8
-      (i64.shr_s
-       (i64.shl
-        (i64.extend_u/i32
-         (get_local $3)
-        )
-        (i64.const 56)
-       )
-       (i64.const 56)
-      )
-     )
-    )
-    (set_local $8
-     (i64.shl
-      (i64.and
-       (get_local $8)
-       (i64.const 31)
-      )
-      (i64.and
-       (get_local $5)
-       (i64.const 4294967295)
-      )
-     )
-    )
-   )
-   (set_local $4
-    (i32.add
-     (get_local $4)
-     (i32.const 1)
-    )
-   )
-   (set_local $6
-    (i64.add
-     (get_local $6)
-     (i64.const 1)
-    )
-   )
-   (set_local $7
-    (i64.or
-     (get_local $8)
-     (get_local $7)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $5
-      (i64.add
-       (get_local $5)
-       (i64.const -5)
-      )
-     )
-     (i64.const -6)
-    )
-   )
-  )
-  (block $label$6
-   (br_if $label$6
-    (i64.ne
-     (get_local $7)
-     (get_local $2)
-    )
-   )
-   (set_local $6
-    (i64.const 0)
-   )
-   (set_local $5
-    (i64.const 59)
-   )
-   (set_local $4
-    (i32.const 1488)
-   )
-   (set_local $7
-    (i64.const 0)
-   )
-   (loop $label$7
-    (block $label$8
-     (block $label$9
-      (block $label$10
-       (block $label$11
-        (block $label$12
-         (br_if $label$12
-          (i64.gt_u
-           (get_local $6)
-           (i64.const 4)
-          )
-         )
-         (br_if $label$11
-          (i32.gt_u
-           (i32.and
-            (i32.add
-             (tee_local $3
-              (i32.load8_s
-               (get_local $4)
-              )
-             )
-             (i32.const -97)
-            )
-            (i32.const 255)
-           )
-           (i32.const 25)
-          )
-         )
-         (set_local $3
-          (i32.add
-           (get_local $3)
-           (i32.const 165)
-          )
-         )
-         (br $label$10)
-        )
-        (set_local $8
-         (i64.const 0)
-        )
-        (br_if $label$9
-         (i64.le_u
-          (get_local $6)
-          (i64.const 11)
-         )
-        )
-        (br $label$8)
-       )
-       (set_local $3
-        (select
-         (i32.add
-          (get_local $3)
-          (i32.const 208)
-         )
-         (i32.const 0)
-         (i32.lt_u
-          (i32.and
-           (i32.add
-            (get_local $3)
-            (i32.const -49)
-           )
-           (i32.const 255)
-          )
-          (i32.const 5)
-         )
-        )
-       )
-      )
-      (set_local $8
-       (i64.shr_s
-        (i64.shl
-         (i64.extend_u/i32
-          (get_local $3)
-         )
-         (i64.const 56)
-        )
-        (i64.const 56)
-       )
-      )
-     )
-     (set_local $8
-      (i64.shl
-       (i64.and
-        (get_local $8)
-        (i64.const 31)
-       )
-       (i64.and
-        (get_local $5)
-        (i64.const 4294967295)
-       )
-      )
-     )
-    )
-    (set_local $4
-     (i32.add
-      (get_local $4)
-      (i32.const 1)
-     )
-    )
-    (set_local $6
-     (i64.add
-      (get_local $6)
-      (i64.const 1)
-     )
-    )
-    (set_local $7
-     (i64.or
-      (get_local $8)
-      (get_local $7)
-     )
-    )
-    (br_if $label$7
-     (i64.ne
-      (tee_local $5
-       (i64.add
-        (get_local $5)
-        (i64.const -5)
-       )
-      )
-      (i64.const -6)
-     )
-    )
-   )
-   (call $eosio_assert
-    (i64.eq
-     (get_local $7)
-     (get_local $1)
-    )
-    (i32.const 1504)
-   )
-  )
-  (block $label$13
-   (block $label$14
-    (br_if $label$14
-     (i64.eq
-      (get_local $1)
-      (get_local $0)
-     )
-    )
-    (set_local $6
-     (i64.const 0)
-    )
-    (set_local $5
-     (i64.const 59)
-    )
-    (set_local $4
-     (i32.const 1472)
-    )
-    (set_local $7
-     (i64.const 0)
-    )
-    (loop $label$15
-     (block $label$16
-      (block $label$17
-       (block $label$18
-        (block $label$19
-         (block $label$20
-          (br_if $label$20
-           (i64.gt_u
-            (get_local $6)
-            (i64.const 6)
-           )
-          )
-          (br_if $label$19
-           (i32.gt_u
-            (i32.and
-             (i32.add
-              (tee_local $3
-               (i32.load8_s
-                (get_local $4)
-               )
-              )
-              (i32.const -97)
-             )
-             (i32.const 255)
-            )
-            (i32.const 25)
-           )
-          )
-          (set_local $3
-           (i32.add
-            (get_local $3)
-            (i32.const 165)
-           )
-          )
-          (br $label$18)
-         )
-         (set_local $8
-          (i64.const 0)
-         )
-         (br_if $label$17
-          (i64.le_u
-           (get_local $6)
-           (i64.const 11)
-          )
-         )
-         (br $label$16)
-        )
-        (set_local $3
-         (select
-          (i32.add
-           (get_local $3)
-           (i32.const 208)
-          )
-          (i32.const 0)
-          (i32.lt_u
-           (i32.and
-            (i32.add
-             (get_local $3)
-             (i32.const -49)
-            )
-            (i32.const 255)
-           )
-           (i32.const 5)
-          )
-         )
-        )
-       )
-       (set_local $8
-        (i64.shr_s
-         (i64.shl
-          (i64.extend_u/i32
-           (get_local $3)
-          )
-          (i64.const 56)
-         )
-         (i64.const 56)
-        )
-       )
-      )
-      (set_local $8
-       (i64.shl
-        (i64.and
-         (get_local $8)
-         (i64.const 31)
-        )
-        (i64.and
-         (get_local $5)
-         (i64.const 4294967295)
-        )
-       )
-      )
-     )
-     (set_local $4
-      (i32.add
-       (get_local $4)
-       (i32.const 1)
-      )
-     )
-     (set_local $6
-      (i64.add
-       (get_local $6)
-       (i64.const 1)
-      )
-     )
-     (set_local $7
-      (i64.or
-       (get_local $8)
-       (get_local $7)
-      )
-     )
-     (br_if $label$15
-      (i64.ne
-       (tee_local $5
-        (i64.add
-         (get_local $5)
-         (i64.const -5)
-        )
-       )
-       (i64.const -6)
-      )
-     )
-    )
-    (br_if $label$13
-     (i64.ne
-      (get_local $7)
-      (get_local $2)
-     )
-    )
-   )
-   (i64.store offset=56
-    (get_local $9)
-    (get_local $0)
-   )
-   (block $label$21
-    (block $label$22
-     (br_if $label$22
-      (i64.eq
-       (get_local $2)
-       (i64.const -3617168760277827584)
-      )
-     )
-     (br_if $label$21
-      (i64.eq
-       (get_local $2)
-       (i64.const 8516769789752901632)
-      )
-     )
-     (br_if $label$13
-      (i64.ne
-       (get_local $2)
-       (i64.const 5031766152489992192)
-      )
-     )
-     (i32.store offset=52
-      (get_local $9)
-      (i32.const 0)
-     )
-     (i32.store offset=48
-      (get_local $9)
-      (i32.const 1)
-     )
-     (i64.store offset=8 align=4
-      (get_local $9)
-      (i64.load offset=48
-       (get_local $9)
-      )
-     )
-     (drop
-      (call $_ZN5eosio14execute_actionINS_5tokenES1_JyNS_5assetEEEEbPT_MT0_FvDpT1_E
-       (i32.add
-        (get_local $9)
-        (i32.const 56)
-       )
-       (i32.add
-        (get_local $9)
-        (i32.const 8)
-       )
-      )
-     )
-     (br $label$13)
-    )
-    (i32.store offset=36
-     (get_local $9)
-     (i32.const 0)
-    )
-    (i32.store offset=32
-     (get_local $9)
-     (i32.const 2)
-    )
-    (i64.store offset=24 align=4
-     (get_local $9)
-     (i64.load offset=32
-      (get_local $9)
-     )
-    )
-    (drop
-     (call $_ZN5eosio14execute_actionINS_5tokenES1_JyyNS_5assetENSt3__112basic_stringIcNS3_11char_traitsIcEENS3_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_E
-      (i32.add
-       (get_local $9)
-       (i32.const 56)
-      )
-      (i32.add
-       (get_local $9)
-       (i32.const 24)
-      )
-     )
-    )
-    (br $label$13)
-   )
-   (i32.store offset=44
-    (get_local $9)
-    (i32.const 0)
-   )
-   (i32.store offset=40
-    (get_local $9)
-    (i32.const 3)
-   )
-   (i64.store offset=16 align=4
-    (get_local $9)
-    (i64.load offset=40
-     (get_local $9)
-    )
-   )
-   (drop
-    (call $_ZN5eosio14execute_actionINS_5tokenES1_JyNS_5assetENSt3__112basic_stringIcNS3_11char_traitsIcEENS3_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_E
-     (i32.add
-      (get_local $9)
-      (i32.const 56)
-     )
-     (i32.add
-      (get_local $9)
-      (i32.const 16)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 64)
-   )
-  )
- )
- (func $_ZN5eosio14execute_actionINS_5tokenES1_JyNS_5assetEEEEbPT_MT0_FvDpT1_E (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (set_local $9
-   (tee_local $7
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 96)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $7)
-  )
-  (set_local $2
-   (i32.load offset=4
-    (get_local $1)
-   )
-  )
-  (set_local $8
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (set_local $1
-   (i32.const 0)
-  )
-  (set_local $5
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (tee_local $3
-      (call $action_data_size)
-     )
-    )
-   )
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i32.lt_u
-       (get_local $3)
-       (i32.const 513)
-      )
-     )
-     (set_local $5
-      (call $malloc
-       (get_local $3)
-      )
-     )
-     (br $label$1)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $5
-      (i32.sub
-       (get_local $7)
-       (i32.and
-        (i32.add
-         (get_local $3)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $read_action_data
-     (get_local $5)
-     (get_local $3)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (get_local $9)
-    (i32.const 40)
-   )
-   (i64.const 1398362884)
-  )
-  (i64.store offset=32
-   (get_local $9)
-   (i64.const 0)
-  )
-  (i64.store offset=24
-   (get_local $9)
-   (i64.const 0)
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 288)
-  )
-  (set_local $6
-   (i64.const 5462355)
-  )
-  (block $label$3
-   (loop $label$4
-    (set_local $7
-     (i32.const 0)
-    )
-    (br_if $label$3
-     (i32.gt_u
-      (i32.add
-       (i32.shl
-        (i32.wrap/i64
-         (get_local $6)
-        )
-        (i32.const 24)
-       )
-       (i32.const -1073741825)
-      )
-      (i32.const 452984830)
-     )
-    )
-    (block $label$5
-     (br_if $label$5
-      (i64.ne
-       (i64.and
-        (tee_local $6
-         (i64.shr_u
-          (get_local $6)
-          (i64.const 8)
-         )
-        )
-        (i64.const 255)
-       )
-       (i64.const 0)
-      )
-     )
-     (loop $label$6
-      (br_if $label$3
-       (i64.ne
-        (i64.and
-         (tee_local $6
-          (i64.shr_u
-           (get_local $6)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (br_if $label$6
-       (i32.lt_s
-        (tee_local $1
-         (i32.add
-          (get_local $1)
-          (i32.const 1)
-         )
-        )
-        (i32.const 7)
-       )
-      )
-     )
-    )
-    (set_local $7
-     (i32.const 1)
-    )
-    (br_if $label$4
-     (i32.lt_s
-      (tee_local $1
-       (i32.add
-        (get_local $1)
-        (i32.const 1)
-       )
-      )
-      (i32.const 7)
-     )
-    )
-   )
-  )
-  (call $eosio_assert
-   (get_local $7)
-   (i32.const 16)
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (get_local $3)
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $9)
-     (i32.const 24)
-    )
-    (get_local $5)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.ne
-    (tee_local $7
-     (i32.and
-      (get_local $3)
-      (i32.const -8)
-     )
-    )
-    (i32.const 8)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (tee_local $1
-     (i32.add
-      (i32.add
-       (get_local $9)
-       (i32.const 24)
-      )
-      (i32.const 8)
-     )
-    )
-    (i32.add
-     (get_local $5)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.ne
-    (get_local $7)
-    (i32.const 16)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (i32.add
-      (get_local $9)
-      (i32.const 24)
-     )
-     (i32.const 16)
-    )
-    (i32.add
-     (get_local $5)
-     (i32.const 16)
-    )
-    (i32.const 8)
-   )
-  )
-  (block $label$7
-   (br_if $label$7
-    (i32.lt_u
-     (get_local $3)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $5)
-   )
-  )
-  (i64.store
-   (tee_local $7
-    (i32.add
-     (i32.add
-      (get_local $9)
-      (i32.const 48)
-     )
-     (i32.const 8)
-    )
-   )
-   (i64.load
-    (i32.add
-     (get_local $1)
-     (i32.const 8)
-    )
-   )
-  )
-  (set_local $6
-   (i64.load offset=24
-    (get_local $9)
-   )
-  )
-  (i64.store offset=48
-   (get_local $9)
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (i64.store
-   (i32.add
-    (i32.add
-     (get_local $9)
-     (i32.const 64)
-    )
-    (i32.const 8)
-   )
-   (i64.load
-    (get_local $7)
-   )
-  )
-  (i64.store offset=64
-   (get_local $9)
-   (i64.load offset=48
-    (get_local $9)
-   )
-  )
-  (set_local $1
-   (i32.add
-    (get_local $0)
-    (i32.shr_s
-     (get_local $2)
-     (i32.const 1)
-    )
-   )
-  )
-  (block $label$8
-   (br_if $label$8
-    (i32.eqz
-     (i32.and
-      (get_local $2)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $8
-    (i32.load
-     (i32.add
-      (i32.load
-       (get_local $1)
-      )
-      (get_local $8)
-     )
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (i32.add
-     (get_local $9)
-     (i32.const 80)
-    )
-    (i32.const 8)
-   )
-   (tee_local $4
-    (i64.load
-     (i32.add
-      (i32.add
-       (get_local $9)
-       (i32.const 64)
-      )
-      (i32.const 8)
-     )
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (i32.add
-     (get_local $9)
-     (i32.const 8)
-    )
-    (i32.const 8)
-   )
-   (get_local $4)
-  )
-  (i64.store offset=80
-   (get_local $9)
-   (tee_local $4
-    (i64.load offset=64
-     (get_local $9)
-    )
-   )
-  )
-  (i64.store offset=8
-   (get_local $9)
-   (get_local $4)
-  )
-  (call_indirect (type $FUNCSIG$viji)
-   (get_local $1)
-   (get_local $6)
-   (i32.add
-    (get_local $9)
-    (i32.const 8)
-   )
-   (get_local $8)
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 96)
-   )
-  )
-  (i32.const 1)
- )
- (func $_ZN5eosio14execute_actionINS_5tokenES1_JyNS_5assetENSt3__112basic_stringIcNS3_11char_traitsIcEENS3_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_E (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i64)
-  (local $4 i32)
-  (local $5 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $4
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 80)
-    )
-   )
-  )
-  (i32.store offset=60
-   (tee_local $5
-    (get_local $4)
-   )
-   (get_local $0)
-  )
-  (i32.store offset=48
-   (get_local $5)
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (i32.store offset=52
-   (get_local $5)
-   (i32.load offset=4
-    (get_local $1)
-   )
-  )
-  (set_local $1
-   (i32.const 0)
-  )
-  (set_local $0
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (tee_local $2
-      (call $action_data_size)
-     )
-    )
-   )
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i32.lt_u
-       (get_local $2)
-       (i32.const 513)
-      )
-     )
-     (set_local $0
-      (call $malloc
-       (get_local $2)
-      )
-     )
-     (br $label$1)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $0
-      (i32.sub
-       (get_local $4)
-       (i32.and
-        (i32.add
-         (get_local $2)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $read_action_data
-     (get_local $0)
-     (get_local $2)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (get_local $5)
-    (i32.const 24)
-   )
-   (i64.const 1398362884)
-  )
-  (i64.store offset=16
-   (get_local $5)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $5)
-   (i64.const 0)
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 288)
-  )
-  (set_local $3
-   (i64.const 5462355)
-  )
-  (block $label$3
-   (block $label$4
-    (loop $label$5
-     (br_if $label$4
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $3)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$6
-      (br_if $label$6
-       (i64.ne
-        (i64.and
-         (tee_local $3
-          (i64.shr_u
-           (get_local $3)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$7
-       (br_if $label$4
-        (i64.ne
-         (i64.and
-          (tee_local $3
-           (i64.shr_u
-            (get_local $3)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$7
-        (i32.lt_s
-         (tee_local $1
-          (i32.add
-           (get_local $1)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $4
-      (i32.const 1)
-     )
-     (br_if $label$5
-      (i32.lt_s
-       (tee_local $1
-        (i32.add
-         (get_local $1)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$3)
-    )
-   )
-   (set_local $4
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $4)
-   (i32.const 16)
-  )
-  (i32.store
-   (i32.add
-    (get_local $5)
-    (i32.const 40)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=32
-   (get_local $5)
-   (i64.const 0)
-  )
-  (i32.store offset=64
-   (get_local $5)
-   (get_local $0)
-  )
-  (i32.store offset=72
-   (get_local $5)
-   (tee_local $1
-    (i32.add
-     (get_local $0)
-     (get_local $2)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (get_local $2)
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $5)
-     (i32.const 8)
-    )
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (get_local $1)
-     (tee_local $4
-      (i32.add
-       (get_local $0)
-       (i32.const 8)
-      )
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (i32.add
-      (get_local $5)
-      (i32.const 8)
-     )
-     (i32.const 8)
-    )
-    (get_local $4)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (get_local $1)
-     (tee_local $4
-      (i32.add
-       (get_local $0)
-       (i32.const 16)
-      )
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (i32.add
-      (get_local $5)
-      (i32.const 8)
-     )
-     (i32.const 16)
-    )
-    (get_local $4)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=68
-   (get_local $5)
-   (i32.add
-    (get_local $0)
-    (i32.const 24)
-   )
-  )
-  (drop
-   (call $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEE
-    (i32.add
-     (get_local $5)
-     (i32.const 64)
-    )
-    (i32.add
-     (i32.add
-      (get_local $5)
-      (i32.const 8)
-     )
-     (i32.const 24)
-    )
-   )
-  )
-  (block $label$8
-   (br_if $label$8
-    (i32.lt_u
-     (get_local $2)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $0)
-   )
-  )
-  (i32.store offset=68
-   (get_local $5)
-   (i32.add
-    (get_local $5)
-    (i32.const 48)
-   )
-  )
-  (i32.store offset=64
-   (get_local $5)
-   (i32.add
-    (get_local $5)
-    (i32.const 60)
-   )
-  )
-  (call $_ZN5boost4mp116detail16tuple_apply_implIRZN5eosio14execute_actionINS3_5tokenES5_JyNS3_5assetENSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_EEUlDpT_E_RNS7_5tupleIJyS6_SD_EEEJLj0ELj1ELj2EEEEDTclclsr3stdE7forwardISE_Efp_Espclsr3stdE3getIXT1_EEclsr3stdE7forwardISG_Efp0_EEEEOSE_OSG_NS0_16integer_sequenceIjJXspT1_EEEE
-   (i32.add
-    (get_local $5)
-    (i32.const 64)
-   )
-   (i32.add
-    (get_local $5)
-    (i32.const 8)
-   )
-  )
-  (block $label$9
-   (br_if $label$9
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=32
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load
-     (i32.add
-      (get_local $5)
-      (i32.const 40)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $5)
-    (i32.const 80)
-   )
-  )
-  (i32.const 1)
- )
- (func $_ZN5eosio14execute_actionINS_5tokenES1_JyyNS_5assetENSt3__112basic_stringIcNS3_11char_traitsIcEENS3_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_E (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i64)
-  (local $4 i32)
-  (local $5 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $4
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 96)
-    )
-   )
-  )
-  (i32.store offset=60
-   (tee_local $5
-    (get_local $4)
-   )
-   (get_local $0)
-  )
-  (i32.store offset=48
-   (get_local $5)
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (i32.store offset=52
-   (get_local $5)
-   (i32.load offset=4
-    (get_local $1)
-   )
-  )
-  (set_local $1
-   (i32.const 0)
-  )
-  (set_local $0
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (tee_local $2
-      (call $action_data_size)
-     )
-    )
-   )
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i32.lt_u
-       (get_local $2)
-       (i32.const 513)
-      )
-     )
-     (set_local $0
-      (call $malloc
-       (get_local $2)
-      )
-     )
-     (br $label$1)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $0
-      (i32.sub
-       (get_local $4)
-       (i32.and
-        (i32.add
-         (get_local $2)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $read_action_data
-     (get_local $0)
-     (get_local $2)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (get_local $5)
-    (i32.const 24)
-   )
-   (i64.const 1398362884)
-  )
-  (i64.store offset=8
-   (get_local $5)
-   (i64.const 0)
-  )
-  (i64.store
-   (get_local $5)
-   (i64.const 0)
-  )
-  (i64.store offset=16
-   (get_local $5)
-   (i64.const 0)
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 288)
-  )
-  (set_local $3
-   (i64.const 5462355)
-  )
-  (block $label$3
-   (block $label$4
-    (loop $label$5
-     (br_if $label$4
-      (i32.gt_u
-       (i32.add
-        (i32.shl
-         (i32.wrap/i64
-          (get_local $3)
-         )
-         (i32.const 24)
-        )
-        (i32.const -1073741825)
-       )
-       (i32.const 452984830)
-      )
-     )
-     (block $label$6
-      (br_if $label$6
-       (i64.ne
-        (i64.and
-         (tee_local $3
-          (i64.shr_u
-           (get_local $3)
-           (i64.const 8)
-          )
-         )
-         (i64.const 255)
-        )
-        (i64.const 0)
-       )
-      )
-      (loop $label$7
-       (br_if $label$4
-        (i64.ne
-         (i64.and
-          (tee_local $3
-           (i64.shr_u
-            (get_local $3)
-            (i64.const 8)
-           )
-          )
-          (i64.const 255)
-         )
-         (i64.const 0)
-        )
-       )
-       (br_if $label$7
-        (i32.lt_s
-         (tee_local $1
-          (i32.add
-           (get_local $1)
-           (i32.const 1)
-          )
-         )
-         (i32.const 7)
-        )
-       )
-      )
-     )
-     (set_local $4
-      (i32.const 1)
-     )
-     (br_if $label$5
-      (i32.lt_s
-       (tee_local $1
-        (i32.add
-         (get_local $1)
-         (i32.const 1)
-        )
-       )
-       (i32.const 7)
-      )
-     )
-     (br $label$3)
-    )
-   )
-   (set_local $4
-    (i32.const 0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $4)
-   (i32.const 16)
-  )
-  (i32.store
-   (i32.add
-    (get_local $5)
-    (i32.const 40)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=32
-   (get_local $5)
-   (i64.const 0)
-  )
-  (i32.store offset=68
-   (get_local $5)
-   (get_local $0)
-  )
-  (i32.store offset=64
-   (get_local $5)
-   (get_local $0)
-  )
-  (i32.store offset=72
-   (get_local $5)
-   (i32.add
-    (get_local $0)
-    (get_local $2)
-   )
-  )
-  (i32.store offset=80
-   (get_local $5)
-   (i32.add
-    (get_local $5)
-    (i32.const 64)
-   )
-  )
-  (i32.store offset=88
-   (get_local $5)
-   (get_local $5)
-  )
-  (call $_ZN5boost6fusion6detail17for_each_unrolledILi4EE4callINS0_18std_tuple_iteratorINSt3__15tupleIJyyN5eosio5assetENS6_12basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEEEELi0EEEZNS8_rsINS8_10datastreamIPKcEEJyyS9_SF_EEERT_SO_RNS7_IJDpT0_EEEEUlSO_E_EEvRKSN_RKT0_
-   (i32.add
-    (get_local $5)
-    (i32.const 88)
-   )
-   (i32.add
-    (get_local $5)
-    (i32.const 80)
-   )
-  )
-  (block $label$8
-   (br_if $label$8
-    (i32.lt_u
-     (get_local $2)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $0)
-   )
-  )
-  (i32.store offset=68
-   (get_local $5)
-   (i32.add
-    (get_local $5)
-    (i32.const 48)
-   )
-  )
-  (i32.store offset=64
-   (get_local $5)
-   (i32.add
-    (get_local $5)
-    (i32.const 60)
-   )
-  )
-  (call $_ZN5boost4mp116detail16tuple_apply_implIRZN5eosio14execute_actionINS3_5tokenES5_JyyNS3_5assetENSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_EEUlDpT_E_RNS7_5tupleIJyyS6_SD_EEEJLj0ELj1ELj2ELj3EEEEDTclclsr3stdE7forwardISE_Efp_Espclsr3stdE3getIXT1_EEclsr3stdE7forwardISG_Efp0_EEEEOSE_OSG_NS0_16integer_sequenceIjJXspT1_EEEE
-   (i32.add
-    (get_local $5)
-    (i32.const 64)
-   )
-   (get_local $5)
-  )
-  (block $label$9
-   (br_if $label$9
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=32
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load
-     (i32.add
-      (get_local $5)
-      (i32.const 40)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $5)
-    (i32.const 96)
-   )
-  )
-  (i32.const 1)
- )
- (func $_ZN5boost6fusion6detail17for_each_unrolledILi4EE4callINS0_18std_tuple_iteratorINSt3__15tupleIJyyN5eosio5assetENS6_12basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEEEELi0EEEZNS8_rsINS8_10datastreamIPKcEEJyyS9_SF_EEERT_SO_RNS7_IJDpT0_EEEEUlSO_E_EEvRKSN_RKT0_ (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (set_local $2
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $3
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $3)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (get_local $2)
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (i32.add
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (set_local $0
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $3
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $3)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $0)
-     (i32.const 8)
-    )
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (i32.add
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $3
-       (i32.load
-        (get_local $1)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $3)
-     )
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $0)
-     (i32.const 16)
-    )
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (tee_local $2
-    (i32.add
-     (i32.load offset=4
-      (get_local $3)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (i32.sub
-     (i32.load offset=8
-      (get_local $3)
-     )
-     (get_local $2)
-    )
-    (i32.const 7)
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $0)
-     (i32.const 24)
-    )
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $3)
-   (i32.add
-    (i32.load offset=4
-     (get_local $3)
-    )
-    (i32.const 8)
-   )
-  )
-  (drop
-   (call $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEE
-    (i32.load
-     (get_local $1)
-    )
-    (i32.add
-     (get_local $0)
-     (i32.const 32)
-    )
-   )
-  )
- )
- (func $_ZN5boost4mp116detail16tuple_apply_implIRZN5eosio14execute_actionINS3_5tokenES5_JyyNS3_5assetENSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_EEUlDpT_E_RNS7_5tupleIJyyS6_SD_EEEJLj0ELj1ELj2ELj3EEEEDTclclsr3stdE7forwardISE_Efp_Espclsr3stdE3getIXT1_EEclsr3stdE7forwardISG_Efp0_EEEEOSE_OSG_NS0_16integer_sequenceIjJXspT1_EEEE (param $0 i32) (param $1 i32)
-  (local $2 i64)
-  (local $3 i64)
-  (local $4 i32)
-  (local $5 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $5
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 96)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $5)
-    (i32.const 44)
-   )
-   (i32.load
-    (i32.add
-     (get_local $1)
-     (i32.const 28)
-    )
-   )
-  )
-  (i32.store
-   (tee_local $4
-    (i32.add
-     (i32.add
-      (get_local $5)
-      (i32.const 32)
-     )
-     (i32.const 8)
-    )
-   )
-   (i32.load
-    (i32.add
-     (get_local $1)
-     (i32.const 24)
-    )
-   )
-  )
-  (i32.store offset=32
-   (get_local $5)
-   (i32.load offset=16
-    (get_local $1)
-   )
-  )
-  (i32.store offset=36
-   (get_local $5)
-   (i32.load
-    (i32.add
-     (get_local $1)
-     (i32.const 20)
-    )
-   )
-  )
-  (set_local $3
-   (i64.load offset=8
-    (get_local $1)
-   )
-  )
-  (set_local $2
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-    (i32.add
-     (get_local $5)
-     (i32.const 16)
-    )
-    (i32.add
-     (get_local $1)
-     (i32.const 32)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (i32.add
-     (get_local $5)
-     (i32.const 48)
-    )
-    (i32.const 8)
-   )
-   (i64.load
-    (get_local $4)
-   )
-  )
-  (i64.store offset=48
-   (get_local $5)
-   (i64.load offset=32
-    (get_local $5)
-   )
-  )
-  (set_local $0
-   (i32.add
-    (i32.load
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (i32.shr_s
-     (tee_local $4
-      (i32.load offset=4
-       (tee_local $1
-        (i32.load offset=4
-         (get_local $0)
-        )
-       )
-      )
-     )
-     (i32.const 1)
-    )
-   )
-  )
-  (set_local $1
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (i32.and
-      (get_local $4)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $1
-    (i32.load
-     (i32.add
-      (i32.load
-       (get_local $0)
-      )
-      (get_local $1)
-     )
-    )
-   )
-  )
-  (i64.store
-   (tee_local $4
-    (i32.add
-     (i32.add
-      (get_local $5)
-      (i32.const 80)
-     )
-     (i32.const 8)
-    )
-   )
-   (i64.load
-    (i32.add
-     (i32.add
-      (get_local $5)
-      (i32.const 48)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (i64.store offset=80
-   (get_local $5)
-   (i64.load offset=48
-    (get_local $5)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-    (i32.add
-     (get_local $5)
-     (i32.const 64)
-    )
-    (i32.add
-     (get_local $5)
-     (i32.const 16)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (get_local $5)
-    (i32.const 8)
-   )
-   (i64.load
-    (get_local $4)
-   )
-  )
-  (i64.store
-   (get_local $5)
-   (i64.load offset=80
-    (get_local $5)
-   )
-  )
-  (call_indirect (type $FUNCSIG$vijjii)
-   (get_local $0)
-   (get_local $2)
-   (get_local $3)
-   (get_local $5)
-   (i32.add
-    (get_local $5)
-    (i32.const 64)
-   )
-   (get_local $1)
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=64
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load offset=72
-     (get_local $5)
-    )
-   )
-  )
-  (block $label$2
-   (br_if $label$2
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=16
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load offset=24
-     (get_local $5)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $5)
-    (i32.const 96)
-   )
-  )
- )
- (func $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $7
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 32)
-    )
-   )
-  )
-  (i32.store offset=24
-   (get_local $7)
-   (i32.const 0)
-  )
-  (i64.store offset=16
-   (get_local $7)
-   (i64.const 0)
-  )
-  (drop
-   (call $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__16vectorIcNS7_9allocatorIcEEEE
-    (get_local $0)
-    (i32.add
-     (get_local $7)
-     (i32.const 16)
-    )
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (block $label$4
-       (block $label$5
-        (block $label$6
-         (block $label$7
-          (block $label$8
-           (br_if $label$8
-            (i32.ne
-             (tee_local $5
-              (i32.load offset=20
-               (get_local $7)
-              )
-             )
-             (tee_local $4
-              (i32.load offset=16
-               (get_local $7)
-              )
-             )
-            )
-           )
-           (br_if $label$7
-            (i32.and
-             (i32.load8_u
-              (get_local $1)
-             )
-             (i32.const 1)
-            )
-           )
-           (i32.store16
-            (get_local $1)
-            (i32.const 0)
-           )
-           (set_local $4
-            (i32.add
-             (get_local $1)
-             (i32.const 8)
-            )
-           )
-           (br $label$6)
-          )
-          (i32.store
-           (i32.add
-            (get_local $7)
-            (i32.const 8)
-           )
-           (i32.const 0)
-          )
-          (i64.store
-           (get_local $7)
-           (i64.const 0)
-          )
-          (br_if $label$0
-           (i32.ge_u
-            (tee_local $2
-             (i32.sub
-              (get_local $5)
-              (get_local $4)
-             )
-            )
-            (i32.const -16)
-           )
-          )
-          (br_if $label$5
-           (i32.ge_u
-            (get_local $2)
-            (i32.const 11)
-           )
-          )
-          (i32.store8
-           (get_local $7)
-           (i32.shl
-            (get_local $2)
-            (i32.const 1)
-           )
-          )
-          (set_local $6
-           (i32.or
-            (get_local $7)
-            (i32.const 1)
-           )
-          )
-          (br_if $label$4
-           (get_local $2)
-          )
-          (br $label$3)
-         )
-         (i32.store8
-          (i32.load offset=8
-           (get_local $1)
-          )
-          (i32.const 0)
-         )
-         (i32.store offset=4
-          (get_local $1)
-          (i32.const 0)
-         )
-         (set_local $4
-          (i32.add
-           (get_local $1)
-           (i32.const 8)
-          )
-         )
-        )
-        (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE7reserveEj
-         (get_local $1)
-         (i32.const 0)
-        )
-        (i32.store
-         (get_local $4)
-         (i32.const 0)
-        )
-        (i64.store align=4
-         (get_local $1)
-         (i64.const 0)
-        )
-        (br_if $label$2
-         (tee_local $4
-          (i32.load offset=16
-           (get_local $7)
-          )
-         )
-        )
-        (br $label$1)
-       )
-       (set_local $6
-        (call $_Znwj
-         (tee_local $5
-          (i32.and
-           (i32.add
-            (get_local $2)
-            (i32.const 16)
-           )
-           (i32.const -16)
-          )
-         )
-        )
-       )
-       (i32.store
-        (get_local $7)
-        (i32.or
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-       (i32.store offset=8
-        (get_local $7)
-        (get_local $6)
-       )
-       (i32.store offset=4
-        (get_local $7)
-        (get_local $2)
-       )
-      )
-      (set_local $3
-       (get_local $2)
-      )
-      (set_local $5
-       (get_local $6)
-      )
-      (loop $label$9
-       (i32.store8
-        (get_local $5)
-        (i32.load8_u
-         (get_local $4)
-        )
-       )
-       (set_local $5
-        (i32.add
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-       (set_local $4
-        (i32.add
-         (get_local $4)
-         (i32.const 1)
-        )
-       )
-       (br_if $label$9
-        (tee_local $3
-         (i32.add
-          (get_local $3)
-          (i32.const -1)
-         )
-        )
-       )
-      )
-      (set_local $6
-       (i32.add
-        (get_local $6)
-        (get_local $2)
-       )
-      )
-     )
-     (i32.store8
-      (get_local $6)
-      (i32.const 0)
-     )
-     (block $label$10
-      (block $label$11
-       (br_if $label$11
-        (i32.and
-         (i32.load8_u
-          (get_local $1)
-         )
-         (i32.const 1)
-        )
-       )
-       (i32.store16
-        (get_local $1)
-        (i32.const 0)
-       )
-       (br $label$10)
-      )
-      (i32.store8
-       (i32.load offset=8
-        (get_local $1)
-       )
-       (i32.const 0)
-      )
-      (i32.store offset=4
-       (get_local $1)
-       (i32.const 0)
-      )
-     )
-     (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE7reserveEj
-      (get_local $1)
-      (i32.const 0)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const 8)
-      )
-      (i32.load
-       (i32.add
-        (get_local $7)
-        (i32.const 8)
-       )
-      )
-     )
-     (i64.store align=4
-      (get_local $1)
-      (i64.load
-       (get_local $7)
-      )
-     )
-     (br_if $label$1
-      (i32.eqz
-       (tee_local $4
-        (i32.load offset=16
-         (get_local $7)
-        )
-       )
-      )
-     )
-    )
-    (i32.store offset=20
-     (get_local $7)
-     (get_local $4)
-    )
-    (call $_ZdlPv
-     (get_local $4)
-    )
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (i32.add
-     (get_local $7)
-     (i32.const 32)
-    )
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (call $_ZNKSt3__121__basic_string_commonILb1EE20__throw_length_errorEv
-   (get_local $7)
-  )
-  (unreachable)
- )
- (func $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__16vectorIcNS7_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (set_local $5
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (set_local $7
-   (i32.const 0)
-  )
-  (set_local $6
-   (i64.const 0)
-  )
-  (set_local $2
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (set_local $3
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-  )
-  (loop $label$0
-   (call $eosio_assert
-    (i32.lt_u
-     (get_local $5)
-     (i32.load
-      (get_local $2)
-     )
-    )
-    (i32.const 1568)
-   )
-   (set_local $4
-    (i32.load8_u
-     (tee_local $5
-      (i32.load
-       (get_local $3)
-      )
-     )
-    )
-   )
-   (i32.store
-    (get_local $3)
-    (tee_local $5
-     (i32.add
-      (get_local $5)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $6
-    (i64.or
-     (i64.extend_u/i32
-      (i32.shl
-       (i32.and
-        (get_local $4)
-        (i32.const 127)
-       )
-       (tee_local $7
-        (i32.and
-         (get_local $7)
-         (i32.const 255)
-        )
-       )
-      )
-     )
-     (get_local $6)
-    )
-   )
-   (set_local $7
-    (i32.add
-     (get_local $7)
-     (i32.const 7)
-    )
-   )
-   (br_if $label$0
-    (i32.shr_u
-     (get_local $4)
-     (i32.const 7)
-    )
-   )
-  )
-  (block $label$1
-   (block $label$2
-    (br_if $label$2
-     (i32.le_u
-      (tee_local $3
-       (i32.wrap/i64
-        (get_local $6)
-       )
-      )
-      (tee_local $2
-       (i32.sub
-        (tee_local $7
-         (i32.load offset=4
-          (get_local $1)
-         )
-        )
-        (tee_local $4
-         (i32.load
-          (get_local $1)
-         )
-        )
-       )
-      )
-     )
-    )
-    (call $_ZNSt3__16vectorIcNS_9allocatorIcEEE8__appendEj
-     (get_local $1)
-     (i32.sub
-      (get_local $3)
-      (get_local $2)
-     )
-    )
-    (set_local $5
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $1)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $4
-     (i32.load
-      (get_local $1)
-     )
-    )
-    (br $label$1)
-   )
-   (br_if $label$1
-    (i32.ge_u
-     (get_local $3)
-     (get_local $2)
-    )
-   )
-   (i32.store
-    (i32.add
-     (get_local $1)
-     (i32.const 4)
-    )
-    (tee_local $7
-     (i32.add
-      (get_local $4)
-      (get_local $3)
-     )
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.ge_u
-    (i32.sub
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 8)
-      )
-     )
-     (get_local $5)
-    )
-    (tee_local $5
-     (i32.sub
-      (get_local $7)
-      (get_local $4)
-     )
-    )
-   )
-   (i32.const 384)
-  )
-  (drop
-   (call $memcpy
-    (get_local $4)
-    (i32.load
-     (tee_local $7
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (get_local $5)
-   )
-  )
-  (i32.store
-   (get_local $7)
-   (i32.add
-    (i32.load
-     (get_local $7)
-    )
-    (get_local $5)
-   )
-  )
-  (get_local $0)
- )
- (func $_ZN5boost4mp116detail16tuple_apply_implIRZN5eosio14execute_actionINS3_5tokenES5_JyNS3_5assetENSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_EEUlDpT_E_RNS7_5tupleIJyS6_SD_EEEJLj0ELj1ELj2EEEEDTclclsr3stdE7forwardISE_Efp_Espclsr3stdE3getIXT1_EEclsr3stdE7forwardISG_Efp0_EEEEOSE_OSG_NS0_16integer_sequenceIjJXspT1_EEEE (param $0 i32) (param $1 i32)
-  (local $2 i64)
-  (local $3 i32)
-  (local $4 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $4
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 96)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (i32.add
-     (get_local $4)
-     (i32.const 32)
-    )
-    (i32.const 12)
-   )
-   (i32.load
-    (i32.add
-     (get_local $1)
-     (i32.const 20)
-    )
-   )
-  )
-  (i32.store
-   (tee_local $3
-    (i32.add
-     (i32.add
-      (get_local $4)
-      (i32.const 32)
-     )
-     (i32.const 8)
-    )
-   )
-   (i32.load
-    (i32.add
-     (get_local $1)
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=32
-   (get_local $4)
-   (i32.load offset=8
-    (get_local $1)
-   )
-  )
-  (i32.store offset=36
-   (get_local $4)
-   (i32.load
-    (i32.add
-     (get_local $1)
-     (i32.const 12)
-    )
-   )
-  )
-  (set_local $2
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-    (i32.add
-     (get_local $4)
-     (i32.const 16)
-    )
-    (i32.add
-     (get_local $1)
-     (i32.const 24)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (i32.add
-     (get_local $4)
-     (i32.const 48)
-    )
-    (i32.const 8)
-   )
-   (i64.load
-    (get_local $3)
-   )
-  )
-  (i64.store offset=48
-   (get_local $4)
-   (i64.load offset=32
-    (get_local $4)
-   )
-  )
-  (set_local $0
-   (i32.add
-    (i32.load
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (i32.shr_s
-     (tee_local $3
-      (i32.load offset=4
-       (tee_local $1
-        (i32.load offset=4
-         (get_local $0)
-        )
-       )
-      )
-     )
-     (i32.const 1)
-    )
-   )
-  )
-  (set_local $1
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (i32.and
-      (get_local $3)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $1
-    (i32.load
-     (i32.add
-      (i32.load
-       (get_local $0)
-      )
-      (get_local $1)
-     )
-    )
-   )
-  )
-  (i64.store
-   (tee_local $3
-    (i32.add
-     (i32.add
-      (get_local $4)
-      (i32.const 80)
-     )
-     (i32.const 8)
-    )
-   )
-   (i64.load
-    (i32.add
-     (i32.add
-      (get_local $4)
-      (i32.const 48)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (i64.store offset=80
-   (get_local $4)
-   (i64.load offset=48
-    (get_local $4)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-    (i32.add
-     (get_local $4)
-     (i32.const 64)
-    )
-    (i32.add
-     (get_local $4)
-     (i32.const 16)
-    )
-   )
-  )
-  (i64.store
-   (i32.add
-    (get_local $4)
-    (i32.const 8)
-   )
-   (i64.load
-    (get_local $3)
-   )
-  )
-  (i64.store
-   (get_local $4)
-   (i64.load offset=80
-    (get_local $4)
-   )
-  )
-  (call_indirect (type $FUNCSIG$vijii)
-   (get_local $0)
-   (get_local $2)
-   (get_local $4)
-   (i32.add
-    (get_local $4)
-    (i32.const 64)
-   )
-   (get_local $1)
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=64
-       (get_local $4)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load offset=72
-     (get_local $4)
-    )
-   )
-  )
-  (block $label$2
-   (br_if $label$2
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=16
-       (get_local $4)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load offset=24
-     (get_local $4)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $4)
-    (i32.const 96)
-   )
-  )
- )
- (func $malloc (param $0 i32) (result i32)
-  (call $_ZN5eosio14memory_manager6mallocEm
-   (i32.const 1572)
-   (get_local $0)
-  )
- )
- (func $_ZN5eosio14memory_manager6mallocEm (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (local $10 i32)
-  (local $11 i32)
-  (local $12 i32)
-  (local $13 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (get_local $1)
-    )
-   )
-   (block $label$1
-    (br_if $label$1
-     (tee_local $13
-      (i32.load offset=8384
-       (get_local $0)
-      )
-     )
-    )
-    (set_local $13
-     (i32.const 16)
-    )
-    (i32.store
-     (i32.add
-      (get_local $0)
-      (i32.const 8384)
-     )
-     (i32.const 16)
-    )
-   )
-   (set_local $2
-    (select
-     (i32.sub
-      (i32.add
-       (get_local $1)
-       (i32.const 8)
-      )
-      (tee_local $2
-       (i32.and
-        (i32.add
-         (get_local $1)
-         (i32.const 4)
-        )
-        (i32.const 7)
-       )
-      )
-     )
-     (get_local $1)
-     (get_local $2)
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (block $label$4
-      (br_if $label$4
-       (i32.ge_u
-        (tee_local $10
-         (i32.load offset=8388
-          (get_local $0)
-         )
-        )
-        (get_local $13)
-       )
-      )
-      (set_local $1
-       (i32.add
-        (i32.add
-         (get_local $0)
-         (i32.mul
-          (get_local $10)
-          (i32.const 12)
-         )
-        )
-        (i32.const 8192)
-       )
-      )
-      (block $label$5
-       (br_if $label$5
-        (get_local $10)
-       )
-       (br_if $label$5
-        (i32.load
-         (tee_local $13
-          (i32.add
-           (get_local $0)
-           (i32.const 8196)
-          )
-         )
-        )
-       )
-       (i32.store
-        (get_local $1)
-        (i32.const 8192)
-       )
-       (i32.store
-        (get_local $13)
-        (get_local $0)
-       )
-      )
-      (set_local $10
-       (i32.add
-        (get_local $2)
-        (i32.const 4)
-       )
-      )
-      (loop $label$6
-       (block $label$7
-        (br_if $label$7
-         (i32.gt_u
-          (i32.add
-           (tee_local $13
-            (i32.load offset=8
-             (get_local $1)
-            )
-           )
-           (get_local $10)
-          )
-          (i32.load
-           (get_local $1)
-          )
-         )
-        )
-        (i32.store
-         (tee_local $13
-          (i32.add
-           (i32.load offset=4
-            (get_local $1)
-           )
-           (get_local $13)
-          )
-         )
-         (i32.or
-          (i32.and
-           (i32.load
-            (get_local $13)
-           )
-           (i32.const -2147483648)
-          )
-          (get_local $2)
-         )
-        )
-        (i32.store
-         (tee_local $1
-          (i32.add
-           (get_local $1)
-           (i32.const 8)
-          )
-         )
-         (i32.add
-          (i32.load
-           (get_local $1)
-          )
-          (get_local $10)
-         )
-        )
-        (i32.store
-         (get_local $13)
-         (i32.or
-          (i32.load
-           (get_local $13)
-          )
-          (i32.const -2147483648)
-         )
-        )
-        (br_if $label$3
-         (tee_local $1
-          (i32.add
-           (get_local $13)
-           (i32.const 4)
-          )
-         )
-        )
-       )
-       (br_if $label$6
-        (tee_local $1
-         (call $_ZN5eosio14memory_manager16next_active_heapEv
-          (get_local $0)
-         )
-        )
-       )
-      )
-     )
-     (set_local $4
-      (i32.sub
-       (i32.const 2147483644)
-       (get_local $2)
-      )
-     )
-     (set_local $11
-      (i32.add
-       (get_local $0)
-       (i32.const 8392)
-      )
-     )
-     (set_local $12
-      (i32.add
-       (get_local $0)
-       (i32.const 8384)
-      )
-     )
-     (set_local $13
-      (tee_local $3
-       (i32.load offset=8392
-        (get_local $0)
-       )
-      )
-     )
-     (loop $label$8
-      (call $eosio_assert
-       (i32.eq
-        (i32.load
-         (i32.add
-          (tee_local $1
-           (i32.add
-            (get_local $0)
-            (i32.mul
-             (get_local $13)
-             (i32.const 12)
-            )
-           )
-          )
-          (i32.const 8200)
-         )
-        )
-        (i32.load
-         (tee_local $5
-          (i32.add
-           (get_local $1)
-           (i32.const 8192)
-          )
-         )
-        )
-       )
-       (i32.const 9968)
-      )
-      (set_local $13
-       (i32.add
-        (tee_local $6
-         (i32.load
-          (i32.add
-           (get_local $1)
-           (i32.const 8196)
-          )
-         )
-        )
-        (i32.const 4)
-       )
-      )
-      (loop $label$9
-       (set_local $7
-        (i32.add
-         (get_local $6)
-         (i32.load
-          (get_local $5)
-         )
-        )
-       )
-       (set_local $1
-        (i32.and
-         (tee_local $9
-          (i32.load
-           (tee_local $8
-            (i32.add
-             (get_local $13)
-             (i32.const -4)
-            )
-           )
-          )
-         )
-         (i32.const 2147483647)
-        )
-       )
-       (block $label$10
-        (br_if $label$10
-         (i32.lt_s
-          (get_local $9)
-          (i32.const 0)
-         )
-        )
-        (block $label$11
-         (br_if $label$11
-          (i32.ge_u
-           (get_local $1)
-           (get_local $2)
-          )
-         )
-         (loop $label$12
-          (br_if $label$11
-           (i32.ge_u
-            (tee_local $10
-             (i32.add
-              (get_local $13)
-              (get_local $1)
-             )
-            )
-            (get_local $7)
-           )
-          )
-          (br_if $label$11
-           (i32.lt_s
-            (tee_local $10
-             (i32.load
-              (get_local $10)
-             )
-            )
-            (i32.const 0)
-           )
-          )
-          (br_if $label$12
-           (i32.lt_u
-            (tee_local $1
-             (i32.add
-              (i32.add
-               (get_local $1)
-               (i32.and
-                (get_local $10)
-                (i32.const 2147483647)
-               )
-              )
-              (i32.const 4)
-             )
-            )
-            (get_local $2)
-           )
-          )
-         )
-        )
-        (i32.store
-         (get_local $8)
-         (i32.or
-          (select
-           (get_local $1)
-           (get_local $2)
-           (i32.lt_u
-            (get_local $1)
-            (get_local $2)
-           )
-          )
-          (i32.and
-           (get_local $9)
-           (i32.const -2147483648)
-          )
-         )
-        )
-        (block $label$13
-         (br_if $label$13
-          (i32.le_u
-           (get_local $1)
-           (get_local $2)
-          )
-         )
-         (i32.store
-          (i32.add
-           (get_local $13)
-           (get_local $2)
-          )
-          (i32.and
-           (i32.add
-            (get_local $4)
-            (get_local $1)
-           )
-           (i32.const 2147483647)
-          )
-         )
-        )
-        (br_if $label$2
-         (i32.ge_u
-          (get_local $1)
-          (get_local $2)
-         )
-        )
-       )
-       (br_if $label$9
-        (i32.lt_u
-         (tee_local $13
-          (i32.add
-           (i32.add
-            (get_local $13)
-            (get_local $1)
-           )
-           (i32.const 4)
-          )
-         )
-         (get_local $7)
-        )
-       )
-      )
-      (set_local $1
-       (i32.const 0)
-      )
-      (i32.store
-       (get_local $11)
-       (tee_local $13
-        (select
-         (i32.const 0)
-         (tee_local $13
-          (i32.add
-           (i32.load
-            (get_local $11)
-           )
-           (i32.const 1)
-          )
-         )
-         (i32.eq
-          (get_local $13)
-          (i32.load
-           (get_local $12)
-          )
-         )
-        )
-       )
-      )
-      (br_if $label$8
-       (i32.ne
-        (get_local $13)
-        (get_local $3)
-       )
-      )
-     )
-    )
-    (return
-     (get_local $1)
-    )
-   )
-   (i32.store
-    (get_local $8)
-    (i32.or
-     (i32.load
-      (get_local $8)
-     )
-     (i32.const -2147483648)
-    )
-   )
-   (return
-    (get_local $13)
-   )
-  )
-  (i32.const 0)
- )
- (func $_ZN5eosio14memory_manager16next_active_heapEv (param $0 i32) (result i32)
-  (local $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (set_local $1
-   (i32.load offset=8388
-    (get_local $0)
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (i32.load8_u offset=10054
-       (i32.const 0)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load offset=10056
-      (i32.const 0)
-     )
-    )
-    (br $label$0)
-   )
-   (set_local $7
-    (current_memory)
-   )
-   (i32.store8 offset=10054
-    (i32.const 0)
-    (i32.const 1)
-   )
-   (i32.store offset=10056
-    (i32.const 0)
-    (tee_local $7
-     (i32.shl
-      (get_local $7)
-      (i32.const 16)
-     )
-    )
-   )
-  )
-  (set_local $3
-   (get_local $7)
-  )
-  (block $label$2
-   (block $label$3
-    (block $label$4
-     (block $label$5
-      (br_if $label$5
-       (i32.le_u
-        (tee_local $2
-         (i32.shr_u
-          (i32.add
-           (get_local $7)
-           (i32.const 65535)
-          )
-          (i32.const 16)
-         )
-        )
-        (tee_local $8
-         (current_memory)
-        )
-       )
-      )
-      (drop
-       (grow_memory
-        (i32.sub
-         (get_local $2)
-         (get_local $8)
-        )
-       )
-      )
-      (set_local $8
-       (i32.const 0)
-      )
-      (br_if $label$4
-       (i32.ne
-        (get_local $2)
-        (current_memory)
-       )
-      )
-      (set_local $3
-       (i32.load offset=10056
-        (i32.const 0)
-       )
-      )
-     )
-     (set_local $8
-      (i32.const 0)
-     )
-     (i32.store offset=10056
-      (i32.const 0)
-      (get_local $3)
-     )
-     (br_if $label$4
-      (i32.lt_s
-       (get_local $7)
-       (i32.const 0)
-      )
-     )
-     (set_local $2
-      (i32.add
-       (get_local $0)
-       (i32.mul
-        (get_local $1)
-        (i32.const 12)
-       )
-      )
-     )
-     (set_local $7
-      (i32.sub
-       (i32.sub
-        (i32.add
-         (get_local $7)
-         (select
-          (i32.const 65536)
-          (i32.const 131072)
-          (tee_local $6
-           (i32.lt_u
-            (tee_local $8
-             (i32.and
-              (get_local $7)
-              (i32.const 65535)
-             )
-            )
-            (i32.const 64513)
-           )
-          )
-         )
-        )
-        (select
-         (get_local $8)
-         (i32.and
-          (get_local $7)
-          (i32.const 131071)
-         )
-         (get_local $6)
-        )
-       )
-       (get_local $7)
-      )
-     )
-     (block $label$6
-      (br_if $label$6
-       (i32.load8_u offset=10054
-        (i32.const 0)
-       )
-      )
-      (set_local $3
-       (current_memory)
-      )
-      (i32.store8 offset=10054
-       (i32.const 0)
-       (i32.const 1)
-      )
-      (i32.store offset=10056
-       (i32.const 0)
-       (tee_local $3
-        (i32.shl
-         (get_local $3)
-         (i32.const 16)
-        )
-       )
-      )
-     )
-     (set_local $2
-      (i32.add
-       (get_local $2)
-       (i32.const 8192)
-      )
-     )
-     (br_if $label$3
-      (i32.lt_s
-       (get_local $7)
-       (i32.const 0)
-      )
-     )
-     (set_local $6
-      (get_local $3)
-     )
-     (block $label$7
-      (br_if $label$7
-       (i32.le_u
-        (tee_local $8
-         (i32.shr_u
-          (i32.add
-           (i32.add
-            (tee_local $5
-             (i32.and
-              (i32.add
-               (get_local $7)
-               (i32.const 7)
-              )
-              (i32.const -8)
-             )
-            )
-            (get_local $3)
-           )
-           (i32.const 65535)
-          )
-          (i32.const 16)
-         )
-        )
-        (tee_local $4
-         (current_memory)
-        )
-       )
-      )
-      (drop
-       (grow_memory
-        (i32.sub
-         (get_local $8)
-         (get_local $4)
-        )
-       )
-      )
-      (br_if $label$3
-       (i32.ne
-        (get_local $8)
-        (current_memory)
-       )
-      )
-      (set_local $6
-       (i32.load offset=10056
-        (i32.const 0)
-       )
-      )
-     )
-     (i32.store offset=10056
-      (i32.const 0)
-      (i32.add
-       (get_local $6)
-       (get_local $5)
-      )
-     )
-     (br_if $label$3
-      (i32.eq
-       (get_local $3)
-       (i32.const -1)
-      )
-     )
-     (br_if $label$2
-      (i32.eq
-       (i32.add
-        (tee_local $6
-         (i32.load
-          (i32.add
-           (tee_local $1
-            (i32.add
-             (get_local $0)
-             (i32.mul
-              (get_local $1)
-              (i32.const 12)
-             )
-            )
-           )
-           (i32.const 8196)
-          )
-         )
-        )
-        (tee_local $8
-         (i32.load
-          (get_local $2)
-         )
-        )
-       )
-       (get_local $3)
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i32.eq
-        (get_local $8)
-        (tee_local $1
-         (i32.load
-          (tee_local $5
-           (i32.add
-            (get_local $1)
-            (i32.const 8200)
-           )
-          )
-         )
-        )
-       )
-      )
-      (i32.store
-       (tee_local $6
-        (i32.add
-         (get_local $6)
-         (get_local $1)
-        )
-       )
-       (i32.or
-        (i32.and
-         (i32.load
-          (get_local $6)
-         )
-         (i32.const -2147483648)
-        )
-        (i32.add
-         (i32.sub
-          (i32.const -4)
-          (get_local $1)
-         )
-         (get_local $8)
-        )
-       )
-      )
-      (i32.store
-       (get_local $5)
-       (i32.load
-        (get_local $2)
-       )
-      )
-      (i32.store
-       (get_local $6)
-       (i32.and
-        (i32.load
-         (get_local $6)
-        )
-        (i32.const 2147483647)
-       )
-      )
-     )
-     (i32.store
-      (tee_local $2
-       (i32.add
-        (get_local $0)
-        (i32.const 8388)
-       )
-      )
-      (tee_local $2
-       (i32.add
-        (i32.load
-         (get_local $2)
-        )
-        (i32.const 1)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (tee_local $0
-        (i32.add
-         (get_local $0)
-         (i32.mul
-          (get_local $2)
-          (i32.const 12)
-         )
-        )
-       )
-       (i32.const 8196)
-      )
-      (get_local $3)
-     )
-     (i32.store
-      (tee_local $8
-       (i32.add
-        (get_local $0)
-        (i32.const 8192)
-       )
-      )
-      (get_local $7)
-     )
-    )
-    (return
-     (get_local $8)
-    )
-   )
-   (block $label$9
-    (br_if $label$9
-     (i32.eq
-      (tee_local $8
-       (i32.load
-        (get_local $2)
-       )
-      )
-      (tee_local $7
-       (i32.load
-        (tee_local $1
-         (i32.add
-          (tee_local $3
-           (i32.add
-            (get_local $0)
-            (i32.mul
-             (get_local $1)
-             (i32.const 12)
-            )
-           )
-          )
-          (i32.const 8200)
-         )
-        )
-       )
-      )
-     )
-    )
-    (i32.store
-     (tee_local $3
-      (i32.add
-       (i32.load
-        (i32.add
-         (get_local $3)
-         (i32.const 8196)
-        )
-       )
-       (get_local $7)
-      )
-     )
-     (i32.or
-      (i32.and
-       (i32.load
-        (get_local $3)
-       )
-       (i32.const -2147483648)
-      )
-      (i32.add
-       (i32.sub
-        (i32.const -4)
-        (get_local $7)
-       )
-       (get_local $8)
-      )
-     )
-    )
-    (i32.store
-     (get_local $1)
-     (i32.load
-      (get_local $2)
-     )
-    )
-    (i32.store
-     (get_local $3)
-     (i32.and
-      (i32.load
-       (get_local $3)
-      )
-      (i32.const 2147483647)
-     )
-    )
-   )
-   (i32.store offset=8384
-    (get_local $0)
-    (tee_local $3
-     (i32.add
-      (i32.load
-       (tee_local $7
-        (i32.add
-         (get_local $0)
-         (i32.const 8388)
-        )
-       )
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (i32.store
-    (get_local $7)
-    (get_local $3)
-   )
-   (return
-    (i32.const 0)
-   )
-  )
-  (i32.store
-   (get_local $2)
-   (i32.add
-    (get_local $8)
-    (get_local $7)
-   )
-  )
-  (get_local $2)
- )
- (func $free (param $0 i32)
-  (local $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (get_local $0)
-     )
-    )
-    (br_if $label$1
-     (i32.lt_s
-      (tee_local $2
-       (i32.load offset=9956
-        (i32.const 0)
-       )
-      )
-      (i32.const 1)
-     )
-    )
-    (set_local $3
-     (i32.const 9764)
-    )
-    (set_local $1
-     (i32.add
-      (i32.mul
-       (get_local $2)
-       (i32.const 12)
-      )
-      (i32.const 9764)
-     )
-    )
-    (loop $label$2
-     (br_if $label$1
-      (i32.eqz
-       (tee_local $2
-        (i32.load
-         (i32.add
-          (get_local $3)
-          (i32.const 4)
-         )
-        )
-       )
-      )
-     )
-     (block $label$3
-      (br_if $label$3
-       (i32.gt_u
-        (i32.add
-         (get_local $2)
-         (i32.const 4)
-        )
-        (get_local $0)
-       )
-      )
-      (br_if $label$0
-       (i32.gt_u
-        (i32.add
-         (get_local $2)
-         (i32.load
-          (get_local $3)
-         )
-        )
-        (get_local $0)
-       )
-      )
-     )
-     (br_if $label$2
-      (i32.lt_u
-       (tee_local $3
-        (i32.add
-         (get_local $3)
-         (i32.const 12)
-        )
-       )
-       (get_local $1)
-      )
-     )
-    )
-   )
-   (return)
-  )
-  (i32.store
-   (tee_local $3
-    (i32.add
-     (get_local $0)
-     (i32.const -4)
-    )
-   )
-   (i32.and
-    (i32.load
-     (get_local $3)
-    )
-    (i32.const 2147483647)
-   )
-  )
- )
- (func $_Znwj (param $0 i32) (result i32)
-  (local $1 i32)
-  (local $2 i32)
-  (block $label$0
-   (br_if $label$0
-    (tee_local $0
-     (call $malloc
-      (tee_local $1
-       (select
-        (get_local $0)
-        (i32.const 1)
-        (get_local $0)
-       )
-      )
-     )
-    )
-   )
-   (loop $label$1
-    (set_local $0
-     (i32.const 0)
-    )
-    (br_if $label$0
-     (i32.eqz
-      (tee_local $2
-       (i32.load offset=10060
-        (i32.const 0)
-       )
-      )
-     )
-    )
-    (call_indirect (type $FUNCSIG$v)
-     (get_local $2)
-    )
-    (br_if $label$1
-     (i32.eqz
-      (tee_local $0
-       (call $malloc
-        (get_local $1)
-       )
-      )
-     )
-    )
-   )
-  )
-  (get_local $0)
- )
- (func $_ZdlPv (param $0 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (get_local $0)
-    )
-   )
-   (call $free
-    (get_local $0)
-   )
-  )
- )
- (func $_ZNKSt3__121__basic_string_commonILb1EE20__throw_length_errorEv (param $0 i32)
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE7reserveEj (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.ge_u
-     (get_local $1)
-     (i32.const -16)
-    )
-   )
-   (set_local $2
-    (i32.const 10)
-   )
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (i32.and
-       (tee_local $5
-        (i32.load8_u
-         (get_local $0)
-        )
-       )
-       (i32.const 1)
-      )
-     )
-    )
-    (set_local $2
-     (i32.add
-      (i32.and
-       (tee_local $5
-        (i32.load
-         (get_local $0)
-        )
-       )
-       (i32.const -2)
-      )
-      (i32.const -1)
-     )
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (br_if $label$3
-      (i32.and
-       (get_local $5)
-       (i32.const 1)
-      )
-     )
-     (set_local $3
-      (i32.shr_u
-       (i32.and
-        (get_local $5)
-        (i32.const 254)
-       )
-       (i32.const 1)
-      )
-     )
-     (br $label$2)
-    )
-    (set_local $3
-     (i32.load offset=4
-      (get_local $0)
-     )
-    )
-   )
-   (set_local $4
-    (i32.const 10)
-   )
-   (block $label$4
-    (br_if $label$4
-     (i32.lt_u
-      (tee_local $1
-       (select
-        (get_local $3)
-        (get_local $1)
-        (i32.gt_u
-         (get_local $3)
-         (get_local $1)
-        )
-       )
-      )
-      (i32.const 11)
-     )
-    )
-    (set_local $4
-     (i32.add
-      (i32.and
-       (i32.add
-        (get_local $1)
-        (i32.const 16)
-       )
-       (i32.const -16)
-      )
-      (i32.const -1)
-     )
-    )
-   )
-   (block $label$5
-    (br_if $label$5
-     (i32.eq
-      (get_local $4)
-      (get_local $2)
-     )
-    )
-    (block $label$6
-     (block $label$7
-      (br_if $label$7
-       (i32.ne
-        (get_local $4)
-        (i32.const 10)
-       )
-      )
-      (set_local $6
-       (i32.const 1)
-      )
-      (set_local $1
-       (i32.add
-        (get_local $0)
-        (i32.const 1)
-       )
-      )
-      (set_local $2
-       (i32.load offset=8
-        (get_local $0)
-       )
-      )
-      (set_local $7
-       (i32.const 0)
-      )
-      (br $label$6)
-     )
-     (set_local $1
-      (call $_Znwj
-       (i32.add
-        (get_local $4)
-        (i32.const 1)
-       )
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i32.gt_u
-        (get_local $4)
-        (get_local $2)
-       )
-      )
-      (br_if $label$5
-       (i32.eqz
-        (get_local $1)
-       )
-      )
-     )
-     (block $label$9
-      (br_if $label$9
-       (i32.and
-        (tee_local $5
-         (i32.load8_u
-          (get_local $0)
-         )
-        )
-        (i32.const 1)
-       )
-      )
-      (set_local $7
-       (i32.const 1)
-      )
-      (set_local $2
-       (i32.add
-        (get_local $0)
-        (i32.const 1)
-       )
-      )
-      (set_local $6
-       (i32.const 0)
-      )
-      (br $label$6)
-     )
-     (set_local $2
-      (i32.load offset=8
-       (get_local $0)
-      )
-     )
-     (set_local $6
-      (i32.const 1)
-     )
-     (set_local $7
-      (i32.const 1)
-     )
-    )
-    (block $label$10
-     (block $label$11
-      (br_if $label$11
-       (i32.and
-        (get_local $5)
-        (i32.const 1)
-       )
-      )
-      (set_local $5
-       (i32.shr_u
-        (i32.and
-         (get_local $5)
-         (i32.const 254)
-        )
-        (i32.const 1)
-       )
-      )
-      (br $label$10)
-     )
-     (set_local $5
-      (i32.load offset=4
-       (get_local $0)
-      )
-     )
-    )
-    (block $label$12
-     (br_if $label$12
-      (i32.eqz
-       (tee_local $5
-        (i32.add
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-      )
-     )
-     (drop
-      (call $memcpy
-       (get_local $1)
-       (get_local $2)
-       (get_local $5)
-      )
-     )
-    )
-    (block $label$13
-     (br_if $label$13
-      (i32.eqz
-       (get_local $6)
-      )
-     )
-     (call $_ZdlPv
-      (get_local $2)
-     )
-    )
-    (block $label$14
-     (br_if $label$14
-      (i32.eqz
-       (get_local $7)
-      )
-     )
-     (i32.store offset=4
-      (get_local $0)
-      (get_local $3)
-     )
-     (i32.store offset=8
-      (get_local $0)
-      (get_local $1)
-     )
-     (i32.store
-      (get_local $0)
-      (i32.or
-       (i32.add
-        (get_local $4)
-        (i32.const 1)
-       )
-       (i32.const 1)
-      )
-     )
-     (return)
-    )
-    (i32.store8
-     (get_local $0)
-     (i32.shl
-      (get_local $3)
-      (i32.const 1)
-     )
-    )
-   )
-   (return)
-  )
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv (param $0 i32)
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_ (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (i64.store align=4
-   (get_local $0)
-   (i64.const 0)
-  )
-  (i32.store
-   (tee_local $3
-    (i32.add
-     (get_local $0)
-     (i32.const 8)
-    )
-   )
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.and
-     (i32.load8_u
-      (get_local $1)
-     )
-     (i32.const 1)
-    )
-   )
-   (i64.store align=4
-    (get_local $0)
-    (i64.load align=4
-     (get_local $1)
-    )
-   )
-   (i32.store
-    (get_local $3)
-    (i32.load
-     (i32.add
-      (get_local $1)
-      (i32.const 8)
-     )
-    )
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.ge_u
-     (tee_local $3
-      (i32.load offset=4
-       (get_local $1)
-      )
-     )
-     (i32.const -16)
-    )
-   )
-   (set_local $2
-    (i32.load offset=8
-     (get_local $1)
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (block $label$4
-      (br_if $label$4
-       (i32.ge_u
-        (get_local $3)
-        (i32.const 11)
-       )
-      )
-      (i32.store8
-       (get_local $0)
-       (i32.shl
-        (get_local $3)
-        (i32.const 1)
-       )
-      )
-      (set_local $1
-       (i32.add
-        (get_local $0)
-        (i32.const 1)
-       )
-      )
-      (br_if $label$3
-       (get_local $3)
-      )
-      (br $label$2)
-     )
-     (set_local $1
-      (call $_Znwj
-       (tee_local $4
-        (i32.and
-         (i32.add
-          (get_local $3)
-          (i32.const 16)
-         )
-         (i32.const -16)
-        )
-       )
-      )
-     )
-     (i32.store
-      (get_local $0)
-      (i32.or
-       (get_local $4)
-       (i32.const 1)
-      )
-     )
-     (i32.store offset=8
-      (get_local $0)
-      (get_local $1)
-     )
-     (i32.store offset=4
-      (get_local $0)
-      (get_local $3)
-     )
-    )
-    (drop
-     (call $memcpy
-      (get_local $1)
-      (get_local $2)
-      (get_local $3)
-     )
-    )
-   )
-   (i32.store8
-    (i32.add
-     (get_local $1)
-     (get_local $3)
-    )
-    (i32.const 0)
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (call $abort)
-  (unreachable)
- )
- (func $memcmp (param $0 i32) (param $1 i32) (param $2 i32) (result i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (set_local $5
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (get_local $2)
-    )
-   )
-   (block $label$1
-    (loop $label$2
-     (br_if $label$1
-      (i32.ne
-       (tee_local $3
-        (i32.load8_u
-         (get_local $0)
-        )
-       )
-       (tee_local $4
-        (i32.load8_u
-         (get_local $1)
-        )
-       )
-      )
-     )
-     (set_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const 1)
-      )
-     )
-     (set_local $0
-      (i32.add
-       (get_local $0)
-       (i32.const 1)
-      )
-     )
-     (br_if $label$2
-      (tee_local $2
-       (i32.add
-        (get_local $2)
-        (i32.const -1)
-       )
-      )
-     )
-     (br $label$0)
-    )
-   )
-   (set_local $5
-    (i32.sub
-     (get_local $3)
-     (get_local $4)
-    )
-   )
-  )
-  (get_local $5)
- )
- (func $__wasm_nullptr (type $FUNCSIG$v)
-  (unreachable)
- )
-)
@@ -0,0 +1,349 @@
+#!/usr/bin/env bash
+#
+#  @file loadgen.sh
+#  @copyright Paul Hodgson @ Unification Foundation
+#
+#  Drives the full data request cycle against a local single node test chain:
+#
+#    consumer initreq (-> provider initperm) -> provider updatereq -> UND transfers
+#
+#  and reports actions/sec, CPU-us per action, RAM bytes per action and
+#  table sizes over time. See loadgen/README.md for chain setup.
+#
+
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+
+NODEOS_URL="${NODEOS_URL:-http://127.0.0.1:8888}"
+PUB_KEY="${PUB_KEY:-EOS6MRyAjQq8ud7hVNYcfnVPJqcVpscN5So8BhtHuGYqET5GDW5CV}"
+PREFIX="lg"
+CONSUMERS=2
+PROVIDERS=2
+USERS=10
+CYCLES=100
+SAMPLE_EVERY=10
+OUT_DIR="${ROOT}/loadgen/out"
+WASM_DIR=""
+SKIP_SETUP=0
+
+usage() {
+    cat <<EOF
+Usage: $0 [options]
+
+  -c N    number of consumer UApps          (default ${CONSUMERS})
+  -p N    number of provider UApps          (default ${PROVIDERS})
+  -u N    number of users, one rewarded per cycle round robin (default ${USERS})
+  -n N    number of request cycles          (default ${CYCLES})
+  -s N    sample RAM/table sizes every N cycles (default ${SAMPLE_EVERY})
+  -x STR  account name prefix, max 3 chars [a-z1-5] (default ${PREFIX})
+  -o DIR  output directory                  (default ${OUT_DIR})
+  -w DIR  deploy eosio.token.{wasm,abi} and unification_uapp.{wasm,abi} from DIR
+          (default: the builds in the contract directories, see ./build.sh)
+  -k      skip account creation / contract deployment (reuse previous run)
+
+Environment: NODEOS_URL (default ${NODEOS_URL}), PUB_KEY (key imported in the
+unlocked wallet, used for every created account and custom permission).
+EOF
+    exit 1
+}
+
+while getopts "c:p:u:n:s:x:o:w:kh" opt; do
+    case "${opt}" in
+        c) CONSUMERS="${OPTARG}" ;;
+        p) PROVIDERS="${OPTARG}" ;;
+        u) USERS="${OPTARG}" ;;
+        n) CYCLES="${OPTARG}" ;;
+        s) SAMPLE_EVERY="${OPTARG}" ;;
+        x) PREFIX="${OPTARG}" ;;
+        o) OUT_DIR="${OPTARG}" ;;
+        w) WASM_DIR="${OPTARG}" ;;
+        k) SKIP_SETUP=1 ;;
+        *) usage ;;
+    esac
+done
+
+for bin in cleos jq awk; do
+    command -v "${bin}" >/dev/null || { echo "${bin} not found in PATH" >&2; exit 1; }
+done
+
+CLEOS=(cleos -u "${NODEOS_URL}")
+TOKEN_ACC="${PREFIX}token"
+SYMBOL="UND"
+
+mkdir -p "${OUT_DIR}"
+SAMPLES_CSV="${OUT_DIR}/samples.csv"
+ACTIONS_CSV="${OUT_DIR}/actions.csv"
+BUILD_TXT="${OUT_DIR}/build.txt"
+
+# directory holding <contract>.wasm and <contract>.abi to deploy
+contract_dir() {
+    if [[ -n "${WASM_DIR}" ]]; then
+        echo "${WASM_DIR}"
+    else
+        echo "${ROOT}/$1"
+    fi
+}
+
+# EOS account names only allow [a-z1-5.], so encode indexes as 3 letters
+acc_name() {
+    local role=$1 idx=$2 letters=abcdefghijklmnopqrstuvwxyz
+    echo "${PREFIX}${role}${letters:$(( idx / 676 % 26 )):1}${letters:$(( idx / 26 % 26 )):1}${letters:$(( idx % 26 )):1}"
+}
+
+now() { date +%s.%N; }
+
+consumer_accs=()
+provider_accs=()
+user_accs=()
+for (( i = 0; i < CONSUMERS; i++ )); do consumer_accs+=("$(acc_name c "${i}")"); done
+for (( i = 0; i < PROVIDERS; i++ )); do provider_accs+=("$(acc_name p "${i}")"); done
+for (( i = 0; i < USERS; i++ )); do user_accs+=("$(acc_name u "${i}")"); done
+
+all_uapps=("${consumer_accs[@]}" "${provider_accs[@]}")
+
+#
+# Setup
+#
+
+# tolerate <pattern> <message> <command...>
+# runs command, treating a failure whose output matches pattern (e.g. "already
+# exists" when re-running setup) as success. Any other failure stops the run.
+tolerate() {
+    local pattern=$1 message=$2 out
+    shift 2
+    if ! out=$("$@" 2>&1); then
+        if ! grep -qi -- "${pattern}" <<< "${out}"; then
+            echo "${out}" >&2
+            echo "setup failed: $*" >&2
+            exit 1
+        fi
+        echo "  ${message}"
+    fi
+}
+
+create_account() {
+    tolerate "already exists" "account $1 already exists, reusing" \
+        "${CLEOS[@]}" create account eosio "$1" "${PUB_KEY}" "${PUB_KEY}"
+}
+
+# custom permission as described in Custom_Permissions.md, including eosio.code
+# so the contract itself can send inline actions using it
+set_uapp_permission() {
+    local acc=$1 perm=$2
+    "${CLEOS[@]}" set account permission "${acc}" "${perm}" \
+        "{\"threshold\":1,\"keys\":[{\"key\":\"${PUB_KEY}\",\"weight\":1}],\"accounts\":[{\"permission\":{\"actor\":\"${acc}\",\"permission\":\"eosio.code\"},\"weight\":1}]}" \
+        active -p "${acc}@active" >/dev/null
+}
+
+link_permission() {
+    tolerate "same as old" "$1 $2::$3 already linked to $4" \
+        "${CLEOS[@]}" set action permission "$1" "$2" "$3" "$4" -p "$1@active"
+}
+
+setup() {
+    echo "Creating accounts"
+    create_account "${TOKEN_ACC}"
+    for acc in "${all_uapps[@]}" "${user_accs[@]}"; do
+        create_account "${acc}"
+    done
+
+    echo "Deploying contracts"
+    : > "${BUILD_TXT}"
+    for contract in eosio.token unification_uapp; do
+        dir=$(contract_dir "${contract}")
+        for f in "${contract}.wasm" "${contract}.abi"; do
+            [[ -f "${dir}/${f}" ]] || { echo "${dir}/${f} not found, run ./build.sh or pass -w DIR" >&2; exit 1; }
+        done
+        # record exactly which build is being measured
+        (cd "${dir}" && sha256sum "${contract}.wasm" "${contract}.abi" | sed "s|  |  ${dir}/|") | tee -a "${BUILD_TXT}"
+    done
+
+    "${CLEOS[@]}" set contract "${TOKEN_ACC}" "$(contract_dir eosio.token)" \
+        eosio.token.wasm eosio.token.abi -p "${TOKEN_ACC}@active" >/dev/null
+    for acc in "${all_uapps[@]}"; do
+        "${CLEOS[@]}" set contract "${acc}" "$(contract_dir unification_uapp)" \
+            unification_uapp.wasm unification_uapp.abi -p "${acc}@active" >/dev/null
+    done
+
+    echo "Setting custom permissions"
+    for acc in "${all_uapps[@]}"; do
+        set_uapp_permission "${acc}" modreq
+        set_uapp_permission "${acc}" modschema
+        link_permission "${acc}" "${acc}" initreq modreq
+        link_permission "${acc}" "${acc}" addschema modschema
+        link_permission "${acc}" "${acc}" setschedule modschema
+    done
+    for c in "${consumer_accs[@]}"; do
+        for p in "${provider_accs[@]}"; do
+            link_permission "${c}" "${p}" initperm modreq
+            link_permission "${p}" "${c}" updatereq modreq
+        done
+    done
+
+    echo "Adding provider schemas"
+    for p in "${provider_accs[@]}"; do
+        "${CLEOS[@]}" push action "${p}" addschema \
+            "[\"QmLoadgenSchema\", 0, 1, 1, 1]" -p "${p}@modschema" >/dev/null
+    done
+
+    echo "Creating and issuing ${SYMBOL}"
+    tolerate "already exists" "${SYMBOL} already exists, reusing" \
+        "${CLEOS[@]}" push action "${TOKEN_ACC}" create \
+        "[\"${TOKEN_ACC}\", \"1000000000.0000 ${SYMBOL}\"]" -p "${TOKEN_ACC}@active"
+    for c in "${consumer_accs[@]}"; do
+        "${CLEOS[@]}" push action "${TOKEN_ACC}" issue \
+            "[\"${c}\", \"1000000.0000 ${SYMBOL}\", \"loadgen\"]" -p "${TOKEN_ACC}@active" >/dev/null
+    done
+}
+
+#
+# Measurement
+#
+
+ram_total() {
+    local total=0 ram
+    for acc in "${TOKEN_ACC}" "${all_uapps[@]}" "${user_accs[@]}"; do
+        ram=$("${CLEOS[@]}" get account "${acc}" -j | jq '.ram_usage')
+        total=$(( total + ram ))
+    done
+    echo "${total}"
+}
+
+# 0 if the table isn't in the deployed ABI, e.g. datareqs2 on an older build
+table_rows() {
+    local rows
+    rows=$("${CLEOS[@]}" get table "$1" "$2" "$3" -l 100000 2>/dev/null | jq '.rows | length' 2>/dev/null || true)
+    echo "${rows:-0}"
+}
+
+datareqs_rows() {
+    local total=0
+    for c in "${consumer_accs[@]}"; do
+        total=$(( total + $(table_rows "${c}" "${c}" datareqs) + $(table_rows "${c}" "${c}" datareqs2) ))
+    done
+    echo "${total}"
+}
+
+userperms_rows() {
+    local total=0
+    for p in "${provider_accs[@]}"; do
+        for c in "${consumer_accs[@]}"; do
+            total=$(( total + $(table_rows "${p}" "${c}" userperms) ))
+        done
+    done
+    echo "${total}"
+}
+
+# push_action <label> <contract> <action> <data> <permission>
+# appends label,cpu_us,net_bytes,elapsed_us,ram_bytes to the actions csv.
+# ram_bytes is the sum of account_ram_deltas over the action and its inline
+# actions, empty if the node doesn't report them
+push_action() {
+    local label=$1 contract=$2 action=$3 data=$4 perm=$5 trace
+    trace=$("${CLEOS[@]}" push action "${contract}" "${action}" "${data}" -p "${perm}" -j 2>/dev/null) \
+        || { echo "  ${label} failed: ${contract}::${action} ${data}" >&2; return 1; }
+    echo "${label},$(jq -r '[.processed.receipt.cpu_usage_us, .processed.receipt.net_usage_words * 8, .processed.elapsed,
+        ([.processed.action_traces[] | recurse(.inline_traces[]?) | (.account_ram_deltas // [])[] | .delta]
+            | if length == 0 then null else add end)] | @csv' <<< "${trace}")" \
+        >> "${ACTIONS_CSV}"
+    actions=$(( actions + 1 ))
+}
+
+sample() {
+    local cycle=$1 t elapsed rate
+    t=$(now)
+    elapsed=$(awk -v a="${start}" -v b="${t}" -v p="${paused}" 'BEGIN { printf "%.3f", b - a - p }')
+    rate=$(awk -v n="${actions}" -v e="${elapsed}" 'BEGIN { printf "%.2f", (e > 0) ? n / e : 0 }')
+    echo "${cycle},${elapsed},${actions},${rate},$(ram_total),$(datareqs_rows),$(userperms_rows)" >> "${SAMPLES_CSV}"
+    echo "  cycle ${cycle}: ${actions} actions, ${rate} actions/sec"
+    # don't count time spent querying the chain against throughput
+    paused=$(awk -v p="${paused}" -v a="${t}" -v b="$(now)" 'BEGIN { printf "%.6f", p + b - a }')
+}
+
+#
+# Run
+#
+
+if [[ "${SKIP_SETUP}" -eq 0 ]]; then
+    setup
+fi
+
+# next datareqs pkey per consumer, continuing from any previous run
+declare -A next_req
+for c in "${consumer_accs[@]}"; do
+    next_req["${c}"]=0
+    for table in datareqs datareqs2; do
+        last=$("${CLEOS[@]}" get table "${c}" "${c}" "${table}" -l 1 -r 2>/dev/null | jq '.rows[0].pkey // -1' || true)
+        if (( ${last:--1} + 1 > next_req[${c}] )); then
+            next_req["${c}"]=$(( last + 1 ))
+        fi
+    done
+done
+
+echo "label,cpu_us,net_bytes,elapsed_us,ram_bytes" > "${ACTIONS_CSV}"
+echo "cycle,elapsed_s,actions,actions_per_sec,ram_bytes,datareqs_rows,userperms_rows" > "${SAMPLES_CSV}"
+
+actions=0
+paused=0
+ram_start=$(ram_total)
+start=$(now)
+sample 0
+
+echo "Running ${CYCLES} cycles: ${CONSUMERS} consumers, ${PROVIDERS} providers, ${USERS} users"
+for (( cycle = 1; cycle <= CYCLES; cycle++ )); do
+    c="${consumer_accs[$(( cycle % CONSUMERS ))]}"
+    p="${provider_accs[$(( cycle % PROVIDERS ))]}"
+    u="${user_accs[$(( cycle % USERS ))]}"
+    ts=$(date +%s)
+    pkey="${next_req[${c}]}"
+
+    push_action initreq "${c}" initreq \
+        "[\"${p}\", 0, ${ts}, ${ts}, 1, \"loadgen query ${cycle}\", 1]" "${c}@modreq"
+    next_req["${c}"]=$(( pkey + 1 ))
+
+    push_action updatereq "${c}" updatereq \
+        "[${pkey}, \"${p}\", \"QmLoadgenHash${cycle}\", ${ts}, \"QmLoadgenAggr${cycle}\"]" "${p}@modreq"
+
+    # single field schema update, cycling through daily, weekly, monthly
+    push_action setschedule "${p}" setschedule \
+        "[0, $(( cycle % 3 + 1 ))]" "${p}@modschema"
+
+    push_action transfer "${TOKEN_ACC}" transfer \
+        "[\"${c}\", \"${p}\", \"1.0000 ${SYMBOL}\", \"loadgen pay ${cycle}\"]" "${c}@active"
+
+    push_action transfer "${TOKEN_ACC}" transfer \
+        "[\"${p}\", \"${u}\", \"0.5000 ${SYMBOL}\", \"loadgen reward ${cycle}\"]" "${p}@active"
+
+    if (( cycle % SAMPLE_EVERY == 0 )); then
+        sample "${cycle}"
+    fi
+done
+
+(( CYCLES % SAMPLE_EVERY == 0 )) || sample "${CYCLES}"
+ram_end=$(ram_total)
+
+#
+# Report
+#
+
+echo
+echo "Summary"
+awk -F, -v n="${actions}" -v ram="$(( ram_end - ram_start ))" '
+    NR == 1 { next }
+    { calls[$1]++; cpu[$1] += $2; net[$1] += $3 }
+    $5 != "" { ram_calls[$1]++; ram_a[$1] += $5 }
+    END {
+        printf "  %-11s %8s %12s %12s %12s\n", "action", "calls", "avg cpu_us", "avg net_B", "avg ram_B"
+        for (a in calls) {
+            printf "  %-11s %8d %12.1f %12.1f %12s\n", a, calls[a], cpu[a] / calls[a], net[a] / calls[a],
+                (a in ram_calls) ? sprintf("%.1f", ram_a[a] / ram_calls[a]) : "n/a"
+        }
+        printf "  RAM delta: %d bytes, %.1f bytes/action\n", ram, (n > 0) ? ram / n : 0
+    }' "${ACTIONS_CSV}"
+tail -n 1 "${SAMPLES_CSV}" | awk -F, '{ printf "  %d actions in %.3fs, %.2f actions/sec\n", $3, $2, $4 }'
+echo "  per action traces: ${ACTIONS_CSV}"
+echo "  samples over time: ${SAMPLES_CSV}"
+if [[ -s "${BUILD_TXT}" ]]; then
+    echo "  deployed builds:   ${BUILD_TXT}"
+fi
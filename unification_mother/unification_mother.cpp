@@ -19,11 +19,13 @@ namespace UnificationFoundation {
  *
  */
 
-    unification_mother::unification_mother(action_name self) : contract(self) {}
+    unification_mother::unification_mother(action_name self) : contract(self), _stats(self) {}
 
     void unification_mother::addnew(const account_name uapp_contract_acc,
                                       const std::string ipfs_hash) {
 
+        _stats.start(N(addnew));
+
         eosio::print(name{_self}, " Called addnew()");
 
         // make sure authorised by unification
@@ -35,23 +37,27 @@ namespace UnificationFoundation {
 
         if (itr == v_apps.end()) {
             //no record for app exists yet. Create one
-            v_apps.emplace(_self /*payer*/, [&](auto &v_rec) {
+            auto new_itr = v_apps.emplace(_self /*payer*/, [&](auto &v_rec) {
                 v_rec.uapp_contract_acc = uapp_contract_acc;
                 v_rec.ipfs_hash = ipfs_hash;
                 v_rec.is_valid = 1;
             });
+            _stats.emplaced(*new_itr);
         } else {
             //requesting app already has record. Update
             v_apps.modify(itr, _self /*payer*/, [&](auto &v_rec) {
                 v_rec.ipfs_hash = ipfs_hash;
                 v_rec.is_valid = 1;
             });
+            _stats.modified(*itr);
         }
 
     }
 
     void unification_mother::validate(const account_name uapp_contract_acc) {
 
+        _stats.start(N(validate));
+
         // make sure authorised by unification
         require_auth(_self);
 
@@ -64,11 +70,14 @@ namespace UnificationFoundation {
         v_apps.modify(itr, _self /*payer*/, [&](auto &v_rec) {
             v_rec.is_valid = 1;
         });
+        _stats.modified(*itr);
 
     }
 
     void unification_mother::invalidate(const account_name uapp_contract_acc) {
 
+        _stats.start(N(invalidate));
+
         // make sure authorised by unification
         require_auth(_self);
 
@@ -81,6 +90,7 @@ namespace UnificationFoundation {
         v_apps.modify(itr, _self /*payer*/, [&](auto &v_rec) {
             v_rec.is_valid = 0;
         });
+        _stats.modified(*itr);
 
     }
 }
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include <eosiolib/eosio.hpp>
 
+#include "../common/unification_stats.hpp"
+
 namespace UnificationFoundation {
     using namespace eosio;
 
@@ -24,6 +26,8 @@ namespace UnificationFoundation {
 
     private:
 
+        stats_recorder _stats;
+
         //@abi table validapps i64
         struct validapps {
             uint64_t uapp_contract_acc;
@@ -1,6910 +0,0 @@
-(module
- (type $FUNCSIG$vij (func (param i32 i64)))
- (type $FUNCSIG$viji (func (param i32 i64 i32)))
- (type $FUNCSIG$v (func))
- (type $FUNCSIG$j (func (result i64)))
- (type $FUNCSIG$vjj (func (param i64 i64)))
- (type $FUNCSIG$vii (func (param i32 i32)))
- (type $FUNCSIG$vj (func (param i64)))
- (type $FUNCSIG$ijjjj (func (param i64 i64 i64 i64) (result i32)))
- (type $FUNCSIG$iiii (func (param i32 i32 i32) (result i32)))
- (type $FUNCSIG$vijii (func (param i32 i64 i32 i32)))
- (type $FUNCSIG$i (func (result i32)))
- (type $FUNCSIG$iii (func (param i32 i32) (result i32)))
- (type $FUNCSIG$vi (func (param i32)))
- (type $FUNCSIG$ijjjjii (func (param i64 i64 i64 i64 i32 i32) (result i32)))
- (import "env" "abort" (func $abort))
- (import "env" "action_data_size" (func $action_data_size (result i32)))
- (import "env" "current_receiver" (func $current_receiver (result i64)))
- (import "env" "current_time" (func $current_time (result i64)))
- (import "env" "db_find_i64" (func $db_find_i64 (param i64 i64 i64 i64) (result i32)))
- (import "env" "db_get_i64" (func $db_get_i64 (param i32 i32 i32) (result i32)))
- (import "env" "db_store_i64" (func $db_store_i64 (param i64 i64 i64 i64 i32 i32) (result i32)))
- (import "env" "db_update_i64" (func $db_update_i64 (param i32 i64 i32 i32)))
- (import "env" "eosio_assert" (func $eosio_assert (param i32 i32)))
- (import "env" "memcpy" (func $memcpy (param i32 i32 i32) (result i32)))
- (import "env" "memmove" (func $memmove (param i32 i32 i32) (result i32)))
- (import "env" "printn" (func $printn (param i64)))
- (import "env" "prints" (func $prints (param i32)))
- (import "env" "read_action_data" (func $read_action_data (param i32 i32) (result i32)))
- (import "env" "require_auth" (func $require_auth (param i64)))
- (import "env" "require_auth2" (func $require_auth2 (param i64 i64)))
- (table 4 4 anyfunc)
- (elem (i32.const 0) $__wasm_nullptr $_ZN21UnificationFoundation18unification_mother6addnewEyNSt3__112basic_stringIcNS1_11char_traitsIcEENS1_9allocatorIcEEEE $_ZN21UnificationFoundation18unification_mother8validateEy $_ZN21UnificationFoundation18unification_mother10invalidateEy)
- (memory $0 1)
- (data (i32.const 4) "\80c\00\00")
- (data (i32.const 16) "onerror\00")
- (data (i32.const 32) "eosio\00")
- (data (i32.const 48) "onerror action\'s are only valid from the \"eosio\" system account\00")
- (data (i32.const 112) "object passed to iterator_to is not in multi_index\00")
- (data (i32.const 176) "Address for account not found\00")
- (data (i32.const 208) "cannot pass end iterator to modify\00")
- (data (i32.const 256) "object passed to modify is not in multi_index\00")
- (data (i32.const 304) "cannot modify objects in table of another contract\00")
- (data (i32.const 368) "updater cannot change primary key when modifying an object\00")
- (data (i32.const 432) "write\00")
- (data (i32.const 448) "error reading iterator\00")
- (data (i32.const 480) "read\00")
- (data (i32.const 496) "get\00")
- (data (i32.const 512) " Called addnew()\00")
- (data (i32.const 544) "cannot create objects in table of another contract\00")
- (data (i32.const 8992) "malloc_from_freed was designed to only be called after _heap was completely allocated\00")
- (export "memory" (memory $0))
- (export "_ZeqRK11checksum256S1_" (func $_ZeqRK11checksum256S1_))
- (export "_ZeqRK11checksum160S1_" (func $_ZeqRK11checksum160S1_))
- (export "_ZneRK11checksum160S1_" (func $_ZneRK11checksum160S1_))
- (export "now" (func $now))
- (export "_ZN5eosio12require_authERKNS_16permission_levelE" (func $_ZN5eosio12require_authERKNS_16permission_levelE))
- (export "apply" (func $apply))
- (export "_ZN21UnificationFoundation18unification_mother6addnewEyNSt3__112basic_stringIcNS1_11char_traitsIcEENS1_9allocatorIcEEEE" (func $_ZN21UnificationFoundation18unification_mother6addnewEyNSt3__112basic_stringIcNS1_11char_traitsIcEENS1_9allocatorIcEEEE))
- (export "_ZN21UnificationFoundation18unification_mother8validateEy" (func $_ZN21UnificationFoundation18unification_mother8validateEy))
- (export "_ZN21UnificationFoundation18unification_mother10invalidateEy" (func $_ZN21UnificationFoundation18unification_mother10invalidateEy))
- (export "_ZN21UnificationFoundation18unification_motherC2Ey" (func $_ZN21UnificationFoundation18unification_motherC2Ey))
- (export "malloc" (func $malloc))
- (export "free" (func $free))
- (export "memcmp" (func $memcmp))
- (func $_ZeqRK11checksum256S1_ (param $0 i32) (param $1 i32) (result i32)
-  (i32.eqz
-   (call $memcmp
-    (get_local $0)
-    (get_local $1)
-    (i32.const 32)
-   )
-  )
- )
- (func $_ZeqRK11checksum160S1_ (param $0 i32) (param $1 i32) (result i32)
-  (i32.eqz
-   (call $memcmp
-    (get_local $0)
-    (get_local $1)
-    (i32.const 32)
-   )
-  )
- )
- (func $_ZneRK11checksum160S1_ (param $0 i32) (param $1 i32) (result i32)
-  (i32.ne
-   (call $memcmp
-    (get_local $0)
-    (get_local $1)
-    (i32.const 32)
-   )
-   (i32.const 0)
-  )
- )
- (func $now (result i32)
-  (i32.wrap/i64
-   (i64.div_u
-    (call $current_time)
-    (i64.const 1000000)
-   )
-  )
- )
- (func $_ZN5eosio12require_authERKNS_16permission_levelE (param $0 i32)
-  (call $require_auth2
-   (i64.load
-    (get_local $0)
-   )
-   (i64.load offset=8
-    (get_local $0)
-   )
-  )
- )
- (func $apply (param $0 i64) (param $1 i64) (param $2 i64)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i64)
-  (local $6 i64)
-  (local $7 i64)
-  (local $8 i64)
-  (local $9 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 64)
-    )
-   )
-  )
-  (set_local $6
-   (i64.const 0)
-  )
-  (set_local $5
-   (i64.const 59)
-  )
-  (set_local $4
-   (i32.const 16)
-  )
-  (set_local $7
-   (i64.const 0)
-  )
-  (loop $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (block $label$4
-       (block $label$5
-        (br_if $label$5
-         (i64.gt_u
-          (get_local $6)
-          (i64.const 6)
-         )
-        )
-        (br_if $label$4
-         (i32.gt_u
-          (i32.and
-           (i32.add
-            (tee_local $3
-             (i32.load8_s
-              (get_local $4)
-             )
-            )
-            (i32.const -97)
-           )
-           (i32.const 255)
-          )
-          (i32.const 25)
-         )
-        )
-        (set_local $3
-         (i32.add
-          (get_local $3)
-          (i32.const 165)
-         )
-        )
-        (br $label$3)
-       )
-       (set_local $8
-        (i64.const 0)
-       )
-       (br_if $label$2
-        (i64.le_u
-         (get_local $6)
-         (i64.const 11)
-        )
-       )
-       (br $label$1)
-      )
-      (set_local $3
-       (select
-        (i32.add
-         (get_local $3)
-         (i32.const 208)
-        )
-        (i32.const 0)
-        (i32.lt_u
-         (i32.and
-          (i32.add
-           (get_local $3)
-           (i32.const -49)
-          )
-          (i32.const 255)
-         )
-         (i32.const 5)
-        )
-       )
-      )
-     )
-     (set_local $8
-      (i64.shr_s
-       (i64.shl
-        (i64.extend_u/i32
-         (get_local $3)
-        )
-        (i64.const 56)
-       )
-       (i64.const 56)
-      )
-     )
-    )
-    (set_local $8
-     (i64.shl
-      (i64.and
-       (get_local $8)
-       (i64.const 31)
-      )
-      (i64.and
-       (get_local $5)
-       (i64.const 4294967295)
-      )
-     )
-    )
-   )
-   (set_local $4
-    (i32.add
-     (get_local $4)
-     (i32.const 1)
-    )
-   )
-   (set_local $6
-    (i64.add
-     (get_local $6)
-     (i64.const 1)
-    )
-   )
-   (set_local $7
-    (i64.or
-     (get_local $8)
-     (get_local $7)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $5
-      (i64.add
-       (get_local $5)
-       (i64.const -5)
-      )
-     )
-     (i64.const -6)
-    )
-   )
-  )
-  (block $label$6
-   (br_if $label$6
-    (i64.ne
-     (get_local $7)
-     (get_local $2)
-    )
-   )
-   (set_local $6
-    (i64.const 0)
-   )
-   (set_local $5
-    (i64.const 59)
-   )
-   (set_local $4
-    (i32.const 32)
-   )
-   (set_local $7
-    (i64.const 0)
-   )
-   (loop $label$7
-    (block $label$8
-     (block $label$9
-      (block $label$10
-       (block $label$11
-        (block $label$12
-         (br_if $label$12
-          (i64.gt_u
-           (get_local $6)
-           (i64.const 4)
-          )
-         )
-         (br_if $label$11
-          (i32.gt_u
-           (i32.and
-            (i32.add
-             (tee_local $3
-              (i32.load8_s
-               (get_local $4)
-              )
-             )
-             (i32.const -97)
-            )
-            (i32.const 255)
-           )
-           (i32.const 25)
-          )
-         )
-         (set_local $3
-          (i32.add
-           (get_local $3)
-           (i32.const 165)
-          )
-         )
-         (br $label$10)
-        )
-        (set_local $8
-         (i64.const 0)
-        )
-        (br_if $label$9
-         (i64.le_u
-          (get_local $6)
-          (i64.const 11)
-         )
-        )
-        (br $label$8)
-       )
-       (set_local $3
-        (select
-         (i32.add
-          (get_local $3)
-          (i32.const 208)
-         )
-         (i32.const 0)
-         (i32.lt_u
-          (i32.and
-           (i32.add
-            (get_local $3)
-            (i32.const -49)
-           )
-           (i32.const 255)
-          )
-          (i32.const 5)
-         )
-        )
-       )
-      )
-      (set_local $8
-       (i64.shr_s
-        (i64.shl
-         (i64.extend_u/i32
-          (get_local $3)
-         )
-         (i64.const 56)
-        )
-        (i64.const 56)
-       )
-      )
-     )
-     (set_local $8
-      (i64.shl
-       (i64.and
-        (get_local $8)
-        (i64.const 31)
-       )
-       (i64.and
-        (get_local $5)
-        (i64.const 4294967295)
-       )
-      )
-     )
-    )
-    (set_local $4
-     (i32.add
-      (get_local $4)
-      (i32.const 1)
-     )
-    )
-    (set_local $6
-     (i64.add
-      (get_local $6)
-      (i64.const 1)
-     )
-    )
-    (set_local $7
-     (i64.or
-      (get_local $8)
-      (get_local $7)
-     )
-    )
-    (br_if $label$7
-     (i64.ne
-      (tee_local $5
-       (i64.add
-        (get_local $5)
-        (i64.const -5)
-       )
-      )
-      (i64.const -6)
-     )
-    )
-   )
-   (call $eosio_assert
-    (i64.eq
-     (get_local $7)
-     (get_local $1)
-    )
-    (i32.const 48)
-   )
-  )
-  (block $label$13
-   (block $label$14
-    (br_if $label$14
-     (i64.eq
-      (get_local $1)
-      (get_local $0)
-     )
-    )
-    (set_local $6
-     (i64.const 0)
-    )
-    (set_local $5
-     (i64.const 59)
-    )
-    (set_local $4
-     (i32.const 16)
-    )
-    (set_local $7
-     (i64.const 0)
-    )
-    (loop $label$15
-     (block $label$16
-      (block $label$17
-       (block $label$18
-        (block $label$19
-         (block $label$20
-          (br_if $label$20
-           (i64.gt_u
-            (get_local $6)
-            (i64.const 6)
-           )
-          )
-          (br_if $label$19
-           (i32.gt_u
-            (i32.and
-             (i32.add
-              (tee_local $3
-               (i32.load8_s
-                (get_local $4)
-               )
-              )
-              (i32.const -97)
-             )
-             (i32.const 255)
-            )
-            (i32.const 25)
-           )
-          )
-          (set_local $3
-           (i32.add
-            (get_local $3)
-            (i32.const 165)
-           )
-          )
-          (br $label$18)
-         )
-         (set_local $8
-          (i64.const 0)
-         )
-         (br_if $label$17
-          (i64.le_u
-           (get_local $6)
-           (i64.const 11)
-          )
-         )
-         (br $label$16)
-        )
-        (set_local $3
-         (select
-          (i32.add
-           (get_local $3)
-           (i32.const 208)
-          )
-          (i32.const 0)
-          (i32.lt_u
-           (i32.and
-            (i32.add
-             (get_local $3)
-             (i32.const -49)
-            )
-            (i32.const 255)
-           )
-           (i32.const 5)
-          )
-         )
-        )
-       )
-       (set_local $8
-        (i64.shr_s
-         (i64.shl
-          (i64.extend_u/i32
-           (get_local $3)
-          )
-          (i64.const 56)
-         )
-         (i64.const 56)
-        )
-       )
-      )
-      (set_local $8
-       (i64.shl
-        (i64.and
-         (get_local $8)
-         (i64.const 31)
-        )
-        (i64.and
-         (get_local $5)
-         (i64.const 4294967295)
-        )
-       )
-      )
-     )
-     (set_local $4
-      (i32.add
-       (get_local $4)
-       (i32.const 1)
-      )
-     )
-     (set_local $6
-      (i64.add
-       (get_local $6)
-       (i64.const 1)
-      )
-     )
-     (set_local $7
-      (i64.or
-       (get_local $8)
-       (get_local $7)
-      )
-     )
-     (br_if $label$15
-      (i64.ne
-       (tee_local $5
-        (i64.add
-         (get_local $5)
-         (i64.const -5)
-        )
-       )
-       (i64.const -6)
-      )
-     )
-    )
-    (br_if $label$13
-     (i64.ne
-      (get_local $7)
-      (get_local $2)
-     )
-    )
-   )
-   (i64.store offset=56
-    (get_local $9)
-    (get_local $0)
-   )
-   (block $label$21
-    (block $label$22
-     (br_if $label$22
-      (i64.eq
-       (get_local $2)
-       (i64.const -2764395866176356352)
-      )
-     )
-     (br_if $label$21
-      (i64.eq
-       (get_local $2)
-       (i64.const 8428038897099505664)
-      )
-     )
-     (br_if $label$13
-      (i64.ne
-       (get_local $2)
-       (i64.const 3626300880115990528)
-      )
-     )
-     (i32.store offset=52
-      (get_local $9)
-      (i32.const 0)
-     )
-     (i32.store offset=48
-      (get_local $9)
-      (i32.const 1)
-     )
-     (i64.store offset=8 align=4
-      (get_local $9)
-      (i64.load offset=48
-       (get_local $9)
-      )
-     )
-     (drop
-      (call $_ZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES2_JyNSt3__112basic_stringIcNS3_11char_traitsIcEENS3_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_E
-       (i32.add
-        (get_local $9)
-        (i32.const 56)
-       )
-       (i32.add
-        (get_local $9)
-        (i32.const 8)
-       )
-      )
-     )
-     (br $label$13)
-    )
-    (i32.store offset=44
-     (get_local $9)
-     (i32.const 0)
-    )
-    (i32.store offset=40
-     (get_local $9)
-     (i32.const 2)
-    )
-    (i64.store offset=16 align=4
-     (get_local $9)
-     (i64.load offset=40
-      (get_local $9)
-     )
-    )
-    (drop
-     (call $_ZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES2_JyEEEbPT_MT0_FvDpT1_E
-      (i32.add
-       (get_local $9)
-       (i32.const 56)
-      )
-      (i32.add
-       (get_local $9)
-       (i32.const 16)
-      )
-     )
-    )
-    (br $label$13)
-   )
-   (i32.store offset=36
-    (get_local $9)
-    (i32.const 0)
-   )
-   (i32.store offset=32
-    (get_local $9)
-    (i32.const 3)
-   )
-   (i64.store offset=24 align=4
-    (get_local $9)
-    (i64.load offset=32
-     (get_local $9)
-    )
-   )
-   (drop
-    (call $_ZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES2_JyEEEbPT_MT0_FvDpT1_E
-     (i32.add
-      (get_local $9)
-      (i32.const 56)
-     )
-     (i32.add
-      (get_local $9)
-      (i32.const 24)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 64)
-   )
-  )
- )
- (func $_ZN21UnificationFoundation18unification_mother6addnewEyNSt3__112basic_stringIcNS1_11char_traitsIcEENS1_9allocatorIcEEEE (type $FUNCSIG$viji) (param $0 i32) (param $1 i64) (param $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i64)
-  (local $6 i32)
-  (local $7 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $7
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 96)
-    )
-   )
-  )
-  (i64.store offset=48
-   (get_local $7)
-   (get_local $1)
-  )
-  (call $printn
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (call $prints
-   (i32.const 512)
-  )
-  (call $require_auth
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (i32.store
-   (tee_local $4
-    (i32.add
-     (get_local $7)
-     (i32.const 40)
-    )
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=24
-   (get_local $7)
-   (i64.const -1)
-  )
-  (i64.store offset=32
-   (get_local $7)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $7)
-   (tee_local $5
-    (i64.load
-     (get_local $0)
-    )
-   )
-  )
-  (i64.store offset=16
-   (get_local $7)
-   (get_local $5)
-  )
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i32.le_s
-       (tee_local $3
-        (call $db_find_i64
-         (get_local $5)
-         (get_local $5)
-         (i64.const -2764395868126707712)
-         (get_local $1)
-        )
-       )
-       (i32.const -1)
-      )
-     )
-     (call $eosio_assert
-      (i32.eq
-       (i32.load offset=24
-        (tee_local $3
-         (call $_ZNK5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE31load_object_by_primary_iteratorEl
-          (i32.add
-           (get_local $7)
-           (i32.const 8)
-          )
-          (get_local $3)
-         )
-        )
-       )
-       (i32.add
-        (get_local $7)
-        (i32.const 8)
-       )
-      )
-      (i32.const 112)
-     )
-     (set_local $5
-      (i64.load
-       (get_local $0)
-      )
-     )
-     (i32.store offset=64
-      (get_local $7)
-      (get_local $2)
-     )
-     (call $eosio_assert
-      (i32.const 1)
-      (i32.const 208)
-     )
-     (call $_ZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE6modifyIZNS2_6addnewEyNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEE3$_1EEvRKS3_yOT_
-      (i32.add
-       (get_local $7)
-       (i32.const 8)
-      )
-      (get_local $3)
-      (get_local $5)
-      (i32.add
-       (get_local $7)
-       (i32.const 64)
-      )
-     )
-     (br_if $label$1
-      (tee_local $3
-       (i32.load offset=32
-        (get_local $7)
-       )
-      )
-     )
-     (br $label$0)
-    )
-    (set_local $5
-     (i64.load
-      (get_local $0)
-     )
-    )
-    (i32.store offset=4
-     (get_local $7)
-     (get_local $2)
-    )
-    (i32.store
-     (get_local $7)
-     (i32.add
-      (get_local $7)
-      (i32.const 48)
-     )
-    )
-    (i64.store offset=88
-     (get_local $7)
-     (get_local $5)
-    )
-    (call $eosio_assert
-     (i64.eq
-      (i64.load offset=8
-       (get_local $7)
-      )
-      (call $current_receiver)
-     )
-     (i32.const 544)
-    )
-    (i32.store offset=68
-     (get_local $7)
-     (get_local $7)
-    )
-    (i32.store offset=64
-     (get_local $7)
-     (i32.add
-      (get_local $7)
-      (i32.const 8)
-     )
-    )
-    (i32.store offset=72
-     (get_local $7)
-     (i32.add
-      (get_local $7)
-      (i32.const 88)
-     )
-    )
-    (i32.store offset=16
-     (tee_local $0
-      (call $_Znwj
-       (i32.const 40)
-      )
-     )
-     (i32.const 0)
-    )
-    (i64.store offset=8 align=4
-     (get_local $0)
-     (i64.const 0)
-    )
-    (i32.store offset=24
-     (get_local $0)
-     (i32.add
-      (get_local $7)
-      (i32.const 8)
-     )
-    )
-    (call $_ZZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE7emplaceIZNS2_6addnewEyNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEE3$_0EENS4_14const_iteratorEyOT_ENKUlRSF_E_clINS4_4itemEEEDaSH_
-     (i32.add
-      (get_local $7)
-      (i32.const 64)
-     )
-     (get_local $0)
-    )
-    (i32.store offset=80
-     (get_local $7)
-     (get_local $0)
-    )
-    (i64.store offset=64
-     (get_local $7)
-     (tee_local $5
-      (i64.load
-       (get_local $0)
-      )
-     )
-    )
-    (i32.store offset=60
-     (get_local $7)
-     (tee_local $3
-      (i32.load offset=28
-       (get_local $0)
-      )
-     )
-    )
-    (block $label$3
-     (block $label$4
-      (br_if $label$4
-       (i32.ge_u
-        (tee_local $2
-         (i32.load
-          (tee_local $6
-           (i32.add
-            (get_local $7)
-            (i32.const 36)
-           )
-          )
-         )
-        )
-        (i32.load
-         (get_local $4)
-        )
-       )
-      )
-      (i64.store offset=8
-       (get_local $2)
-       (get_local $5)
-      )
-      (i32.store offset=16
-       (get_local $2)
-       (get_local $3)
-      )
-      (i32.store offset=80
-       (get_local $7)
-       (i32.const 0)
-      )
-      (i32.store
-       (get_local $2)
-       (get_local $0)
-      )
-      (i32.store
-       (get_local $6)
-       (i32.add
-        (get_local $2)
-        (i32.const 24)
-       )
-      )
-      (br $label$3)
-     )
-     (call $_ZNSt3__16vectorIN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE8item_ptrENS_9allocatorIS7_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS6_4itemENS_14default_deleteISD_EEEERyRlEEEvDpOT_
-      (i32.add
-       (get_local $7)
-       (i32.const 32)
-      )
-      (i32.add
-       (get_local $7)
-       (i32.const 80)
-      )
-      (i32.add
-       (get_local $7)
-       (i32.const 64)
-      )
-      (i32.add
-       (get_local $7)
-       (i32.const 60)
-      )
-     )
-    )
-    (set_local $0
-     (i32.load offset=80
-      (get_local $7)
-     )
-    )
-    (i32.store offset=80
-     (get_local $7)
-     (i32.const 0)
-    )
-    (block $label$5
-     (br_if $label$5
-      (i32.eqz
-       (get_local $0)
-      )
-     )
-     (block $label$6
-      (br_if $label$6
-       (i32.eqz
-        (i32.and
-         (i32.load8_u offset=8
-          (get_local $0)
-         )
-         (i32.const 1)
-        )
-       )
-      )
-      (call $_ZdlPv
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 16)
-        )
-       )
-      )
-     )
-     (call $_ZdlPv
-      (get_local $0)
-     )
-    )
-    (br_if $label$0
-     (i32.eqz
-      (tee_local $3
-       (i32.load offset=32
-        (get_local $7)
-       )
-      )
-     )
-    )
-   )
-   (block $label$7
-    (block $label$8
-     (br_if $label$8
-      (i32.eq
-       (tee_local $0
-        (i32.load
-         (tee_local $4
-          (i32.add
-           (get_local $7)
-           (i32.const 36)
-          )
-         )
-        )
-       )
-       (get_local $3)
-      )
-     )
-     (loop $label$9
-      (set_local $2
-       (i32.load
-        (tee_local $0
-         (i32.add
-          (get_local $0)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $0)
-       (i32.const 0)
-      )
-      (block $label$10
-       (br_if $label$10
-        (i32.eqz
-         (get_local $2)
-        )
-       )
-       (block $label$11
-        (br_if $label$11
-         (i32.eqz
-          (i32.and
-           (i32.load8_u offset=8
-            (get_local $2)
-           )
-           (i32.const 1)
-          )
-         )
-        )
-        (call $_ZdlPv
-         (i32.load
-          (i32.add
-           (get_local $2)
-           (i32.const 16)
-          )
-         )
-        )
-       )
-       (call $_ZdlPv
-        (get_local $2)
-       )
-      )
-      (br_if $label$9
-       (i32.ne
-        (get_local $3)
-        (get_local $0)
-       )
-      )
-     )
-     (set_local $0
-      (i32.load
-       (i32.add
-        (get_local $7)
-        (i32.const 32)
-       )
-      )
-     )
-     (br $label$7)
-    )
-    (set_local $0
-     (get_local $3)
-    )
-   )
-   (i32.store
-    (get_local $4)
-    (get_local $3)
-   )
-   (call $_ZdlPv
-    (get_local $0)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $7)
-    (i32.const 96)
-   )
-  )
- )
- (func $_ZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES2_JyNSt3__112basic_stringIcNS3_11char_traitsIcEENS3_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_E (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $3
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 64)
-    )
-   )
-  )
-  (i32.store offset=44
-   (tee_local $2
-    (get_local $3)
-   )
-   (get_local $0)
-  )
-  (i32.store offset=32
-   (get_local $2)
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (i32.store offset=36
-   (get_local $2)
-   (i32.load offset=4
-    (get_local $1)
-   )
-  )
-  (set_local $1
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (tee_local $0
-      (call $action_data_size)
-     )
-    )
-   )
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i32.lt_u
-       (get_local $0)
-       (i32.const 513)
-      )
-     )
-     (set_local $1
-      (call $malloc
-       (get_local $0)
-      )
-     )
-     (br $label$1)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $1
-      (i32.sub
-       (get_local $3)
-       (i32.and
-        (i32.add
-         (get_local $0)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $read_action_data
-     (get_local $1)
-     (get_local $0)
-    )
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $2)
-    (i32.const 24)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=8
-   (get_local $2)
-   (i64.const 0)
-  )
-  (i64.store offset=16
-   (get_local $2)
-   (i64.const 0)
-  )
-  (i32.store offset=56
-   (get_local $2)
-   (i32.add
-    (get_local $1)
-    (get_local $0)
-   )
-  )
-  (i32.store offset=48
-   (get_local $2)
-   (get_local $1)
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (get_local $0)
-    (i32.const 7)
-   )
-   (i32.const 480)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $2)
-     (i32.const 8)
-    )
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=52
-   (get_local $2)
-   (i32.add
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (drop
-   (call $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEE
-    (i32.add
-     (get_local $2)
-     (i32.const 48)
-    )
-    (i32.add
-     (i32.add
-      (get_local $2)
-      (i32.const 8)
-     )
-     (i32.const 8)
-    )
-   )
-  )
-  (block $label$3
-   (br_if $label$3
-    (i32.lt_u
-     (get_local $0)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $1)
-   )
-  )
-  (i32.store offset=52
-   (get_local $2)
-   (i32.add
-    (get_local $2)
-    (i32.const 32)
-   )
-  )
-  (i32.store offset=48
-   (get_local $2)
-   (i32.add
-    (get_local $2)
-    (i32.const 44)
-   )
-  )
-  (call $_ZN5boost4mp116detail16tuple_apply_implIRZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES6_JyNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_EEUlDpT_E_RNS7_5tupleIJySD_EEEJLj0ELj1EEEEDTclclsr3stdE7forwardISE_Efp_Espclsr3stdE3getIXT1_EEclsr3stdE7forwardISG_Efp0_EEEEOSE_OSG_NS0_16integer_sequenceIjJXspT1_EEEE
-   (i32.add
-    (get_local $2)
-    (i32.const 48)
-   )
-   (i32.add
-    (get_local $2)
-    (i32.const 8)
-   )
-  )
-  (block $label$4
-   (br_if $label$4
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=16
-       (get_local $2)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load
-     (i32.add
-      (get_local $2)
-      (i32.const 24)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $2)
-    (i32.const 64)
-   )
-  )
-  (i32.const 1)
- )
- (func $_ZN21UnificationFoundation18unification_mother8validateEy (type $FUNCSIG$vij) (param $0 i32) (param $1 i64)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $6
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 48)
-    )
-   )
-  )
-  (call $require_auth
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $6)
-    (i32.const 40)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=24
-   (get_local $6)
-   (i64.const -1)
-  )
-  (i64.store offset=32
-   (get_local $6)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $6)
-   (tee_local $4
-    (i64.load
-     (get_local $0)
-    )
-   )
-  )
-  (i64.store offset=16
-   (get_local $6)
-   (get_local $4)
-  )
-  (set_local $3
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.lt_s
-     (tee_local $2
-      (call $db_find_i64
-       (get_local $4)
-       (get_local $4)
-       (i64.const -2764395868126707712)
-       (get_local $1)
-      )
-     )
-     (i32.const 0)
-    )
-   )
-   (call $eosio_assert
-    (i32.eq
-     (i32.load offset=24
-      (tee_local $3
-       (call $_ZNK5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE31load_object_by_primary_iteratorEl
-        (i32.add
-         (get_local $6)
-         (i32.const 8)
-        )
-        (get_local $2)
-       )
-      )
-     )
-     (i32.add
-      (get_local $6)
-      (i32.const 8)
-     )
-    )
-    (i32.const 112)
-   )
-  )
-  (call $eosio_assert
-   (tee_local $2
-    (i32.ne
-     (get_local $3)
-     (i32.const 0)
-    )
-   )
-   (i32.const 176)
-  )
-  (set_local $4
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $2)
-   (i32.const 208)
-  )
-  (call $_ZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE6modifyIZNS2_8validateEyE3$_2EEvRKS3_yOT_
-   (i32.add
-    (get_local $6)
-    (i32.const 8)
-   )
-   (get_local $3)
-   (get_local $4)
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (tee_local $2
-      (i32.load offset=32
-       (get_local $6)
-      )
-     )
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (br_if $label$3
-      (i32.eq
-       (tee_local $0
-        (i32.load
-         (tee_local $5
-          (i32.add
-           (get_local $6)
-           (i32.const 36)
-          )
-         )
-        )
-       )
-       (get_local $2)
-      )
-     )
-     (loop $label$4
-      (set_local $3
-       (i32.load
-        (tee_local $0
-         (i32.add
-          (get_local $0)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $0)
-       (i32.const 0)
-      )
-      (block $label$5
-       (br_if $label$5
-        (i32.eqz
-         (get_local $3)
-        )
-       )
-       (block $label$6
-        (br_if $label$6
-         (i32.eqz
-          (i32.and
-           (i32.load8_u offset=8
-            (get_local $3)
-           )
-           (i32.const 1)
-          )
-         )
-        )
-        (call $_ZdlPv
-         (i32.load
-          (i32.add
-           (get_local $3)
-           (i32.const 16)
-          )
-         )
-        )
-       )
-       (call $_ZdlPv
-        (get_local $3)
-       )
-      )
-      (br_if $label$4
-       (i32.ne
-        (get_local $2)
-        (get_local $0)
-       )
-      )
-     )
-     (set_local $0
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const 32)
-       )
-      )
-     )
-     (br $label$2)
-    )
-    (set_local $0
-     (get_local $2)
-    )
-   )
-   (i32.store
-    (get_local $5)
-    (get_local $2)
-   )
-   (call $_ZdlPv
-    (get_local $0)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $6)
-    (i32.const 48)
-   )
-  )
- )
- (func $_ZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES2_JyEEEbPT_MT0_FvDpT1_E (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i64)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (set_local $6
-   (tee_local $4
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $4)
-  )
-  (set_local $2
-   (i32.load offset=4
-    (get_local $1)
-   )
-  )
-  (set_local $5
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (br_if $label$3
-       (i32.eqz
-        (tee_local $1
-         (call $action_data_size)
-        )
-       )
-      )
-      (br_if $label$2
-       (i32.lt_u
-        (get_local $1)
-        (i32.const 513)
-       )
-      )
-      (set_local $4
-       (call $malloc
-        (get_local $1)
-       )
-      )
-      (br $label$1)
-     )
-     (set_local $4
-      (i32.const 0)
-     )
-     (br $label$0)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $4
-      (i32.sub
-       (get_local $4)
-       (i32.and
-        (i32.add
-         (get_local $1)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $read_action_data
-     (get_local $4)
-     (get_local $1)
-    )
-   )
-  )
-  (i64.store offset=8
-   (get_local $6)
-   (i64.const 0)
-  )
-  (call $eosio_assert
-   (i32.gt_u
-    (get_local $1)
-    (i32.const 7)
-   )
-   (i32.const 480)
-  )
-  (drop
-   (call $memcpy
-    (i32.add
-     (get_local $6)
-     (i32.const 8)
-    )
-    (get_local $4)
-    (i32.const 8)
-   )
-  )
-  (set_local $3
-   (i64.load offset=8
-    (get_local $6)
-   )
-  )
-  (block $label$4
-   (br_if $label$4
-    (i32.lt_u
-     (get_local $1)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $4)
-   )
-  )
-  (set_local $1
-   (i32.add
-    (get_local $0)
-    (i32.shr_s
-     (get_local $2)
-     (i32.const 1)
-    )
-   )
-  )
-  (block $label$5
-   (br_if $label$5
-    (i32.eqz
-     (i32.and
-      (get_local $2)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $5
-    (i32.load
-     (i32.add
-      (i32.load
-       (get_local $1)
-      )
-      (get_local $5)
-     )
-    )
-   )
-  )
-  (call_indirect (type $FUNCSIG$vij)
-   (get_local $1)
-   (get_local $3)
-   (get_local $5)
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $6)
-    (i32.const 16)
-   )
-  )
-  (i32.const 1)
- )
- (func $_ZN21UnificationFoundation18unification_mother10invalidateEy (type $FUNCSIG$vij) (param $0 i32) (param $1 i64)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $6
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 48)
-    )
-   )
-  )
-  (call $require_auth
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (i32.store
-   (i32.add
-    (get_local $6)
-    (i32.const 40)
-   )
-   (i32.const 0)
-  )
-  (i64.store offset=24
-   (get_local $6)
-   (i64.const -1)
-  )
-  (i64.store offset=32
-   (get_local $6)
-   (i64.const 0)
-  )
-  (i64.store offset=8
-   (get_local $6)
-   (tee_local $4
-    (i64.load
-     (get_local $0)
-    )
-   )
-  )
-  (i64.store offset=16
-   (get_local $6)
-   (get_local $4)
-  )
-  (set_local $3
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.lt_s
-     (tee_local $2
-      (call $db_find_i64
-       (get_local $4)
-       (get_local $4)
-       (i64.const -2764395868126707712)
-       (get_local $1)
-      )
-     )
-     (i32.const 0)
-    )
-   )
-   (call $eosio_assert
-    (i32.eq
-     (i32.load offset=24
-      (tee_local $3
-       (call $_ZNK5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE31load_object_by_primary_iteratorEl
-        (i32.add
-         (get_local $6)
-         (i32.const 8)
-        )
-        (get_local $2)
-       )
-      )
-     )
-     (i32.add
-      (get_local $6)
-      (i32.const 8)
-     )
-    )
-    (i32.const 112)
-   )
-  )
-  (call $eosio_assert
-   (tee_local $2
-    (i32.ne
-     (get_local $3)
-     (i32.const 0)
-    )
-   )
-   (i32.const 176)
-  )
-  (set_local $4
-   (i64.load
-    (get_local $0)
-   )
-  )
-  (call $eosio_assert
-   (get_local $2)
-   (i32.const 208)
-  )
-  (call $_ZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE6modifyIZNS2_10invalidateEyE3$_3EEvRKS3_yOT_
-   (i32.add
-    (get_local $6)
-    (i32.const 8)
-   )
-   (get_local $3)
-   (get_local $4)
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (tee_local $2
-      (i32.load offset=32
-       (get_local $6)
-      )
-     )
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (br_if $label$3
-      (i32.eq
-       (tee_local $0
-        (i32.load
-         (tee_local $5
-          (i32.add
-           (get_local $6)
-           (i32.const 36)
-          )
-         )
-        )
-       )
-       (get_local $2)
-      )
-     )
-     (loop $label$4
-      (set_local $3
-       (i32.load
-        (tee_local $0
-         (i32.add
-          (get_local $0)
-          (i32.const -24)
-         )
-        )
-       )
-      )
-      (i32.store
-       (get_local $0)
-       (i32.const 0)
-      )
-      (block $label$5
-       (br_if $label$5
-        (i32.eqz
-         (get_local $3)
-        )
-       )
-       (block $label$6
-        (br_if $label$6
-         (i32.eqz
-          (i32.and
-           (i32.load8_u offset=8
-            (get_local $3)
-           )
-           (i32.const 1)
-          )
-         )
-        )
-        (call $_ZdlPv
-         (i32.load
-          (i32.add
-           (get_local $3)
-           (i32.const 16)
-          )
-         )
-        )
-       )
-       (call $_ZdlPv
-        (get_local $3)
-       )
-      )
-      (br_if $label$4
-       (i32.ne
-        (get_local $2)
-        (get_local $0)
-       )
-      )
-     )
-     (set_local $0
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const 32)
-       )
-      )
-     )
-     (br $label$2)
-    )
-    (set_local $0
-     (get_local $2)
-    )
-   )
-   (i32.store
-    (get_local $5)
-    (get_local $2)
-   )
-   (call $_ZdlPv
-    (get_local $0)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $6)
-    (i32.const 48)
-   )
-  )
- )
- (func $_ZNK5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE31load_object_by_primary_iteratorEl (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i64)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (set_local $8
-   (tee_local $9
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 48)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $9)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eq
-     (tee_local $7
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 28)
-       )
-      )
-     )
-     (tee_local $2
-      (i32.load offset=24
-       (get_local $0)
-      )
-     )
-    )
-   )
-   (set_local $3
-    (i32.sub
-     (i32.const 0)
-     (get_local $2)
-    )
-   )
-   (set_local $6
-    (i32.add
-     (get_local $7)
-     (i32.const -24)
-    )
-   )
-   (loop $label$1
-    (br_if $label$0
-     (i32.eq
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const 16)
-       )
-      )
-      (get_local $1)
-     )
-    )
-    (set_local $7
-     (get_local $6)
-    )
-    (set_local $6
-     (tee_local $4
-      (i32.add
-       (get_local $6)
-       (i32.const -24)
-      )
-     )
-    )
-    (br_if $label$1
-     (i32.ne
-      (i32.add
-       (get_local $4)
-       (get_local $3)
-      )
-      (i32.const -24)
-     )
-    )
-   )
-  )
-  (block $label$2
-   (block $label$3
-    (br_if $label$3
-     (i32.eq
-      (get_local $7)
-      (get_local $2)
-     )
-    )
-    (set_local $6
-     (i32.load
-      (i32.add
-       (get_local $7)
-       (i32.const -24)
-      )
-     )
-    )
-    (br $label$2)
-   )
-   (call $eosio_assert
-    (i32.xor
-     (i32.shr_u
-      (tee_local $6
-       (call $db_get_i64
-        (get_local $1)
-        (i32.const 0)
-        (i32.const 0)
-       )
-      )
-      (i32.const 31)
-     )
-     (i32.const 1)
-    )
-    (i32.const 448)
-   )
-   (block $label$4
-    (block $label$5
-     (br_if $label$5
-      (i32.lt_u
-       (get_local $6)
-       (i32.const 513)
-      )
-     )
-     (set_local $4
-      (call $malloc
-       (get_local $6)
-      )
-     )
-     (br $label$4)
-    )
-    (i32.store offset=4
-     (i32.const 0)
-     (tee_local $4
-      (i32.sub
-       (get_local $9)
-       (i32.and
-        (i32.add
-         (get_local $6)
-         (i32.const 15)
-        )
-        (i32.const -16)
-       )
-      )
-     )
-    )
-   )
-   (drop
-    (call $db_get_i64
-     (get_local $1)
-     (get_local $4)
-     (get_local $6)
-    )
-   )
-   (i32.store offset=36
-    (get_local $8)
-    (get_local $4)
-   )
-   (i32.store offset=32
-    (get_local $8)
-    (get_local $4)
-   )
-   (i32.store offset=40
-    (get_local $8)
-    (tee_local $7
-     (i32.add
-      (get_local $4)
-      (get_local $6)
-     )
-    )
-   )
-   (block $label$6
-    (br_if $label$6
-     (i32.le_u
-      (get_local $6)
-      (i32.const 512)
-     )
-    )
-    (call $free
-     (get_local $4)
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $8)
-       (i32.const 40)
-      )
-     )
-    )
-    (set_local $4
-     (i32.load offset=36
-      (get_local $8)
-     )
-    )
-   )
-   (i32.store offset=16
-    (tee_local $6
-     (call $_Znwj
-      (i32.const 40)
-     )
-    )
-    (i32.const 0)
-   )
-   (i64.store offset=8 align=4
-    (get_local $6)
-    (i64.const 0)
-   )
-   (i32.store offset=24
-    (get_local $6)
-    (get_local $0)
-   )
-   (call $eosio_assert
-    (i32.gt_u
-     (i32.sub
-      (get_local $7)
-      (get_local $4)
-     )
-     (i32.const 7)
-    )
-    (i32.const 480)
-   )
-   (drop
-    (call $memcpy
-     (get_local $6)
-     (get_local $4)
-     (i32.const 8)
-    )
-   )
-   (i32.store offset=36
-    (get_local $8)
-    (i32.add
-     (get_local $4)
-     (i32.const 8)
-    )
-   )
-   (call $eosio_assert
-    (i32.ne
-     (i32.load offset=8
-      (tee_local $4
-       (call $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEE
-        (i32.add
-         (get_local $8)
-         (i32.const 32)
-        )
-        (i32.add
-         (get_local $6)
-         (i32.const 8)
-        )
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $4)
-     )
-    )
-    (i32.const 480)
-   )
-   (drop
-    (call $memcpy
-     (i32.add
-      (get_local $6)
-      (i32.const 20)
-     )
-     (i32.load offset=4
-      (get_local $4)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store offset=28
-    (get_local $6)
-    (get_local $1)
-   )
-   (i32.store offset=4
-    (get_local $4)
-    (i32.add
-     (i32.load offset=4
-      (get_local $4)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store offset=24
-    (get_local $8)
-    (get_local $6)
-   )
-   (i64.store offset=16
-    (get_local $8)
-    (tee_local $5
-     (i64.load
-      (get_local $6)
-     )
-    )
-   )
-   (i32.store offset=12
-    (get_local $8)
-    (tee_local $7
-     (i32.load offset=28
-      (get_local $6)
-     )
-    )
-   )
-   (block $label$7
-    (block $label$8
-     (br_if $label$8
-      (i32.ge_u
-       (tee_local $4
-        (i32.load
-         (tee_local $1
-          (i32.add
-           (get_local $0)
-           (i32.const 28)
-          )
-         )
-        )
-       )
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 32)
-        )
-       )
-      )
-     )
-     (i64.store offset=8
-      (get_local $4)
-      (get_local $5)
-     )
-     (i32.store offset=16
-      (get_local $4)
-      (get_local $7)
-     )
-     (i32.store offset=24
-      (get_local $8)
-      (i32.const 0)
-     )
-     (i32.store
-      (get_local $4)
-      (get_local $6)
-     )
-     (i32.store
-      (get_local $1)
-      (i32.add
-       (get_local $4)
-       (i32.const 24)
-      )
-     )
-     (br $label$7)
-    )
-    (call $_ZNSt3__16vectorIN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE8item_ptrENS_9allocatorIS7_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS6_4itemENS_14default_deleteISD_EEEERyRlEEEvDpOT_
-     (i32.add
-      (get_local $0)
-      (i32.const 24)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 24)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 16)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 12)
-     )
-    )
-   )
-   (set_local $4
-    (i32.load offset=24
-     (get_local $8)
-    )
-   )
-   (i32.store offset=24
-    (get_local $8)
-    (i32.const 0)
-   )
-   (br_if $label$2
-    (i32.eqz
-     (get_local $4)
-    )
-   )
-   (block $label$9
-    (br_if $label$9
-     (i32.eqz
-      (i32.and
-       (i32.load8_u offset=8
-        (get_local $4)
-       )
-       (i32.const 1)
-      )
-     )
-    )
-    (call $_ZdlPv
-     (i32.load
-      (i32.add
-       (get_local $4)
-       (i32.const 16)
-      )
-     )
-    )
-   )
-   (call $_ZdlPv
-    (get_local $4)
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 48)
-   )
-  )
-  (get_local $6)
- )
- (func $_ZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE6modifyIZNS2_10invalidateEyE3$_3EEvRKS3_yOT_ (param $0 i32) (param $1 i32) (param $2 i64)
-  (local $3 i64)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (local $9 i32)
-  (set_local $9
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $8)
-  )
-  (call $eosio_assert
-   (i32.eq
-    (i32.load offset=24
-     (get_local $1)
-    )
-    (get_local $0)
-   )
-   (i32.const 256)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (i64.load
-     (get_local $0)
-    )
-    (call $current_receiver)
-   )
-   (i32.const 304)
-  )
-  (i32.store8 offset=20
-   (get_local $1)
-   (i32.const 0)
-  )
-  (set_local $3
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 368)
-  )
-  (set_local $6
-   (i32.add
-    (tee_local $5
-     (select
-      (i32.load
-       (i32.add
-        (get_local $1)
-        (i32.const 12)
-       )
-      )
-      (i32.shr_u
-       (tee_local $6
-        (i32.load8_u offset=8
-         (get_local $1)
-        )
-       )
-       (i32.const 1)
-      )
-      (i32.and
-       (get_local $6)
-       (i32.const 1)
-      )
-     )
-    )
-    (i32.const 9)
-   )
-  )
-  (set_local $7
-   (i64.extend_u/i32
-    (get_local $5)
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $1)
-    (i32.const 20)
-   )
-  )
-  (loop $label$0
-   (set_local $6
-    (i32.add
-     (get_local $6)
-     (i32.const 1)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $7
-      (i64.shr_u
-       (get_local $7)
-       (i64.const 7)
-      )
-     )
-     (i64.const 0)
-    )
-   )
-  )
-  (block $label$1
-   (block $label$2
-    (br_if $label$2
-     (i32.lt_u
-      (get_local $6)
-      (i32.const 513)
-     )
-    )
-    (set_local $8
-     (call $malloc
-      (get_local $6)
-     )
-    )
-    (br $label$1)
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (tee_local $8
-     (i32.sub
-      (get_local $8)
-      (i32.and
-       (i32.add
-        (get_local $6)
-        (i32.const 15)
-       )
-       (i32.const -16)
-      )
-     )
-    )
-   )
-  )
-  (i32.store
-   (get_local $9)
-   (get_local $8)
-  )
-  (i32.store offset=8
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (get_local $6)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (get_local $6)
-    (i32.const 7)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (get_local $8)
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $5
-       (call $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE
-        (get_local $9)
-        (get_local $5)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $5)
-     )
-    )
-    (i32.const 0)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $5)
-    )
-    (get_local $4)
-    (i32.const 1)
-   )
-  )
-  (i32.store offset=4
-   (get_local $5)
-   (i32.add
-    (i32.load offset=4
-     (get_local $5)
-    )
-    (i32.const 1)
-   )
-  )
-  (call $db_update_i64
-   (i32.load offset=28
-    (get_local $1)
-   )
-   (get_local $2)
-   (get_local $8)
-   (get_local $6)
-  )
-  (block $label$3
-   (br_if $label$3
-    (i32.lt_u
-     (get_local $6)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $8)
-   )
-  )
-  (block $label$4
-   (br_if $label$4
-    (i64.lt_u
-     (get_local $3)
-     (i64.load offset=16
-      (get_local $0)
-     )
-    )
-   )
-   (i64.store
-    (i32.add
-     (get_local $0)
-     (i32.const 16)
-    )
-    (select
-     (i64.const -2)
-     (i64.add
-      (get_local $3)
-      (i64.const 1)
-     )
-     (i64.gt_u
-      (get_local $3)
-      (i64.const -3)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 16)
-   )
-  )
- )
- (func $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (set_local $7
-   (i64.extend_u/i32
-    (select
-     (i32.load offset=4
-      (get_local $1)
-     )
-     (i32.shr_u
-      (tee_local $5
-       (i32.load8_u
-        (get_local $1)
-       )
-      )
-      (i32.const 1)
-     )
-     (i32.and
-      (get_local $5)
-      (i32.const 1)
-     )
-    )
-   )
-  )
-  (set_local $6
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-  )
-  (loop $label$0
-   (set_local $2
-    (i32.wrap/i64
-     (get_local $7)
-    )
-   )
-   (i32.store8 offset=15
-    (get_local $8)
-    (i32.or
-     (i32.shl
-      (tee_local $3
-       (i64.ne
-        (tee_local $7
-         (i64.shr_u
-          (get_local $7)
-          (i64.const 7)
-         )
-        )
-        (i64.const 0)
-       )
-      )
-      (i32.const 7)
-     )
-     (i32.and
-      (get_local $2)
-      (i32.const 127)
-     )
-    )
-   )
-   (call $eosio_assert
-    (i32.gt_s
-     (i32.sub
-      (i32.load
-       (get_local $4)
-      )
-      (get_local $6)
-     )
-     (i32.const 0)
-    )
-    (i32.const 432)
-   )
-   (drop
-    (call $memcpy
-     (i32.load
-      (get_local $5)
-     )
-     (i32.add
-      (get_local $8)
-      (i32.const 15)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store
-    (get_local $5)
-    (tee_local $6
-     (i32.add
-      (i32.load
-       (get_local $5)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (br_if $label$0
-    (get_local $3)
-   )
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (tee_local $5
-      (select
-       (i32.load
-        (i32.add
-         (get_local $1)
-         (i32.const 4)
-        )
-       )
-       (i32.shr_u
-        (tee_local $5
-         (i32.load8_u
-          (get_local $1)
-         )
-        )
-        (i32.const 1)
-       )
-       (tee_local $2
-        (i32.and
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-      )
-     )
-    )
-   )
-   (set_local $3
-    (i32.load offset=8
-     (get_local $1)
-    )
-   )
-   (call $eosio_assert
-    (i32.ge_s
-     (i32.sub
-      (i32.load
-       (i32.add
-        (get_local $0)
-        (i32.const 8)
-       )
-      )
-      (get_local $6)
-     )
-     (get_local $5)
-    )
-    (i32.const 432)
-   )
-   (drop
-    (call $memcpy
-     (i32.load
-      (tee_local $6
-       (i32.add
-        (get_local $0)
-        (i32.const 4)
-       )
-      )
-     )
-     (select
-      (get_local $3)
-      (i32.add
-       (get_local $1)
-       (i32.const 1)
-      )
-      (get_local $2)
-     )
-     (get_local $5)
-    )
-   )
-   (i32.store
-    (get_local $6)
-    (i32.add
-     (i32.load
-      (get_local $6)
-     )
-     (get_local $5)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 16)
-   )
-  )
-  (get_local $0)
- )
- (func $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $7
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 32)
-    )
-   )
-  )
-  (i32.store offset=24
-   (get_local $7)
-   (i32.const 0)
-  )
-  (i64.store offset=16
-   (get_local $7)
-   (i64.const 0)
-  )
-  (drop
-   (call $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__16vectorIcNS7_9allocatorIcEEEE
-    (get_local $0)
-    (i32.add
-     (get_local $7)
-     (i32.const 16)
-    )
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (block $label$4
-       (block $label$5
-        (block $label$6
-         (block $label$7
-          (block $label$8
-           (br_if $label$8
-            (i32.ne
-             (tee_local $5
-              (i32.load offset=20
-               (get_local $7)
-              )
-             )
-             (tee_local $4
-              (i32.load offset=16
-               (get_local $7)
-              )
-             )
-            )
-           )
-           (br_if $label$7
-            (i32.and
-             (i32.load8_u
-              (get_local $1)
-             )
-             (i32.const 1)
-            )
-           )
-           (i32.store16
-            (get_local $1)
-            (i32.const 0)
-           )
-           (set_local $4
-            (i32.add
-             (get_local $1)
-             (i32.const 8)
-            )
-           )
-           (br $label$6)
-          )
-          (i32.store
-           (i32.add
-            (get_local $7)
-            (i32.const 8)
-           )
-           (i32.const 0)
-          )
-          (i64.store
-           (get_local $7)
-           (i64.const 0)
-          )
-          (br_if $label$0
-           (i32.ge_u
-            (tee_local $2
-             (i32.sub
-              (get_local $5)
-              (get_local $4)
-             )
-            )
-            (i32.const -16)
-           )
-          )
-          (br_if $label$5
-           (i32.ge_u
-            (get_local $2)
-            (i32.const 11)
-           )
-          )
-          (i32.store8
-           (get_local $7)
-           (i32.shl
-            (get_local $2)
-            (i32.const 1)
-           )
-          )
-          (set_local $6
-           (i32.or
-            (get_local $7)
-            (i32.const 1)
-           )
-          )
-          (br_if $label$4
-           (get_local $2)
-          )
-          (br $label$3)
-         )
-         (i32.store8
-          (i32.load offset=8
-           (get_local $1)
-          )
-          (i32.const 0)
-         )
-         (i32.store offset=4
-          (get_local $1)
-          (i32.const 0)
-         )
-         (set_local $4
-          (i32.add
-           (get_local $1)
-           (i32.const 8)
-          )
-         )
-        )
-        (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE7reserveEj
-         (get_local $1)
-         (i32.const 0)
-        )
-        (i32.store
-         (get_local $4)
-         (i32.const 0)
-        )
-        (i64.store align=4
-         (get_local $1)
-         (i64.const 0)
-        )
-        (br_if $label$2
-         (tee_local $4
-          (i32.load offset=16
-           (get_local $7)
-          )
-         )
-        )
-        (br $label$1)
-       )
-       (set_local $6
-        (call $_Znwj
-         (tee_local $5
-          (i32.and
-           (i32.add
-            (get_local $2)
-            (i32.const 16)
-           )
-           (i32.const -16)
-          )
-         )
-        )
-       )
-       (i32.store
-        (get_local $7)
-        (i32.or
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-       (i32.store offset=8
-        (get_local $7)
-        (get_local $6)
-       )
-       (i32.store offset=4
-        (get_local $7)
-        (get_local $2)
-       )
-      )
-      (set_local $3
-       (get_local $2)
-      )
-      (set_local $5
-       (get_local $6)
-      )
-      (loop $label$9
-       (i32.store8
-        (get_local $5)
-        (i32.load8_u
-         (get_local $4)
-        )
-       )
-       (set_local $5
-        (i32.add
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-       (set_local $4
-        (i32.add
-         (get_local $4)
-         (i32.const 1)
-        )
-       )
-       (br_if $label$9
-        (tee_local $3
-         (i32.add
-          (get_local $3)
-          (i32.const -1)
-         )
-        )
-       )
-      )
-      (set_local $6
-       (i32.add
-        (get_local $6)
-        (get_local $2)
-       )
-      )
-     )
-     (i32.store8
-      (get_local $6)
-      (i32.const 0)
-     )
-     (block $label$10
-      (block $label$11
-       (br_if $label$11
-        (i32.and
-         (i32.load8_u
-          (get_local $1)
-         )
-         (i32.const 1)
-        )
-       )
-       (i32.store16
-        (get_local $1)
-        (i32.const 0)
-       )
-       (br $label$10)
-      )
-      (i32.store8
-       (i32.load offset=8
-        (get_local $1)
-       )
-       (i32.const 0)
-      )
-      (i32.store offset=4
-       (get_local $1)
-       (i32.const 0)
-      )
-     )
-     (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE7reserveEj
-      (get_local $1)
-      (i32.const 0)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const 8)
-      )
-      (i32.load
-       (i32.add
-        (get_local $7)
-        (i32.const 8)
-       )
-      )
-     )
-     (i64.store align=4
-      (get_local $1)
-      (i64.load
-       (get_local $7)
-      )
-     )
-     (br_if $label$1
-      (i32.eqz
-       (tee_local $4
-        (i32.load offset=16
-         (get_local $7)
-        )
-       )
-      )
-     )
-    )
-    (i32.store offset=20
-     (get_local $7)
-     (get_local $4)
-    )
-    (call $_ZdlPv
-     (get_local $4)
-    )
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (i32.add
-     (get_local $7)
-     (i32.const 32)
-    )
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (call $_ZNKSt3__121__basic_string_commonILb1EE20__throw_length_errorEv
-   (get_local $7)
-  )
-  (unreachable)
- )
- (func $_ZNSt3__16vectorIN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE8item_ptrENS_9allocatorIS7_EEE24__emplace_back_slow_pathIJNS_10unique_ptrINS6_4itemENS_14default_deleteISD_EEEERyRlEEEvDpOT_ (param $0 i32) (param $1 i32) (param $2 i32) (param $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.ge_u
-      (tee_local $5
-       (i32.add
-        (tee_local $4
-         (i32.div_s
-          (i32.sub
-           (i32.load offset=4
-            (get_local $0)
-           )
-           (tee_local $6
-            (i32.load
-             (get_local $0)
-            )
-           )
-          )
-          (i32.const 24)
-         )
-        )
-        (i32.const 1)
-       )
-      )
-      (i32.const 178956971)
-     )
-    )
-    (set_local $7
-     (i32.const 178956970)
-    )
-    (block $label$2
-     (block $label$3
-      (br_if $label$3
-       (i32.gt_u
-        (tee_local $6
-         (i32.div_s
-          (i32.sub
-           (i32.load offset=8
-            (get_local $0)
-           )
-           (get_local $6)
-          )
-          (i32.const 24)
-         )
-        )
-        (i32.const 89478484)
-       )
-      )
-      (br_if $label$2
-       (i32.eqz
-        (tee_local $7
-         (select
-          (get_local $5)
-          (tee_local $7
-           (i32.shl
-            (get_local $6)
-            (i32.const 1)
-           )
-          )
-          (i32.lt_u
-           (get_local $7)
-           (get_local $5)
-          )
-         )
-        )
-       )
-      )
-     )
-     (set_local $6
-      (call $_Znwj
-       (i32.mul
-        (get_local $7)
-        (i32.const 24)
-       )
-      )
-     )
-     (br $label$0)
-    )
-    (set_local $7
-     (i32.const 0)
-    )
-    (set_local $6
-     (i32.const 0)
-    )
-    (br $label$0)
-   )
-   (call $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv
-    (get_local $0)
-   )
-   (unreachable)
-  )
-  (set_local $5
-   (i32.load
-    (get_local $1)
-   )
-  )
-  (i32.store
-   (get_local $1)
-   (i32.const 0)
-  )
-  (i32.store
-   (tee_local $1
-    (i32.add
-     (get_local $6)
-     (i32.mul
-      (get_local $4)
-      (i32.const 24)
-     )
-    )
-   )
-   (get_local $5)
-  )
-  (i64.store offset=8
-   (get_local $1)
-   (i64.load
-    (get_local $2)
-   )
-  )
-  (i32.store offset=16
-   (get_local $1)
-   (i32.load
-    (get_local $3)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $6)
-    (i32.mul
-     (get_local $7)
-     (i32.const 24)
-    )
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $1)
-    (i32.const 24)
-   )
-  )
-  (block $label$4
-   (block $label$5
-    (br_if $label$5
-     (i32.eq
-      (tee_local $6
-       (i32.load
-        (i32.add
-         (get_local $0)
-         (i32.const 4)
-        )
-       )
-      )
-      (tee_local $7
-       (i32.load
-        (get_local $0)
-       )
-      )
-     )
-    )
-    (loop $label$6
-     (set_local $3
-      (i32.load
-       (tee_local $2
-        (i32.add
-         (get_local $6)
-         (i32.const -24)
-        )
-       )
-      )
-     )
-     (i32.store
-      (get_local $2)
-      (i32.const 0)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -24)
-      )
-      (get_local $3)
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -8)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -8)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -12)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -12)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (get_local $1)
-       (i32.const -16)
-      )
-      (i32.load
-       (i32.add
-        (get_local $6)
-        (i32.const -16)
-       )
-      )
-     )
-     (set_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const -24)
-      )
-     )
-     (set_local $6
-      (get_local $2)
-     )
-     (br_if $label$6
-      (i32.ne
-       (get_local $7)
-       (get_local $2)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $6
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (br $label$4)
-   )
-   (set_local $6
-    (get_local $7)
-   )
-  )
-  (i32.store
-   (get_local $0)
-   (get_local $1)
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-   (get_local $5)
-  )
-  (i32.store
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-   (get_local $4)
-  )
-  (block $label$7
-   (br_if $label$7
-    (i32.eq
-     (get_local $7)
-     (get_local $6)
-    )
-   )
-   (loop $label$8
-    (set_local $1
-     (i32.load
-      (tee_local $7
-       (i32.add
-        (get_local $7)
-        (i32.const -24)
-       )
-      )
-     )
-    )
-    (i32.store
-     (get_local $7)
-     (i32.const 0)
-    )
-    (block $label$9
-     (br_if $label$9
-      (i32.eqz
-       (get_local $1)
-      )
-     )
-     (block $label$10
-      (br_if $label$10
-       (i32.eqz
-        (i32.and
-         (i32.load8_u offset=8
-          (get_local $1)
-         )
-         (i32.const 1)
-        )
-       )
-      )
-      (call $_ZdlPv
-       (i32.load
-        (i32.add
-         (get_local $1)
-         (i32.const 16)
-        )
-       )
-      )
-     )
-     (call $_ZdlPv
-      (get_local $1)
-     )
-    )
-    (br_if $label$8
-     (i32.ne
-      (get_local $6)
-      (get_local $7)
-     )
-    )
-   )
-  )
-  (block $label$11
-   (br_if $label$11
-    (i32.eqz
-     (get_local $6)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $6)
-   )
-  )
- )
- (func $_ZN5eosiorsINS_10datastreamIPKcEEEERT_S6_RNSt3__16vectorIcNS7_9allocatorIcEEEE (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (set_local $5
-   (i32.load offset=4
-    (get_local $0)
-   )
-  )
-  (set_local $7
-   (i32.const 0)
-  )
-  (set_local $6
-   (i64.const 0)
-  )
-  (set_local $2
-   (i32.add
-    (get_local $0)
-    (i32.const 8)
-   )
-  )
-  (set_local $3
-   (i32.add
-    (get_local $0)
-    (i32.const 4)
-   )
-  )
-  (loop $label$0
-   (call $eosio_assert
-    (i32.lt_u
-     (get_local $5)
-     (i32.load
-      (get_local $2)
-     )
-    )
-    (i32.const 496)
-   )
-   (set_local $4
-    (i32.load8_u
-     (tee_local $5
-      (i32.load
-       (get_local $3)
-      )
-     )
-    )
-   )
-   (i32.store
-    (get_local $3)
-    (tee_local $5
-     (i32.add
-      (get_local $5)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $6
-    (i64.or
-     (i64.extend_u/i32
-      (i32.shl
-       (i32.and
-        (get_local $4)
-        (i32.const 127)
-       )
-       (tee_local $7
-        (i32.and
-         (get_local $7)
-         (i32.const 255)
-        )
-       )
-      )
-     )
-     (get_local $6)
-    )
-   )
-   (set_local $7
-    (i32.add
-     (get_local $7)
-     (i32.const 7)
-    )
-   )
-   (br_if $label$0
-    (i32.shr_u
-     (get_local $4)
-     (i32.const 7)
-    )
-   )
-  )
-  (block $label$1
-   (block $label$2
-    (br_if $label$2
-     (i32.le_u
-      (tee_local $3
-       (i32.wrap/i64
-        (get_local $6)
-       )
-      )
-      (tee_local $2
-       (i32.sub
-        (tee_local $7
-         (i32.load offset=4
-          (get_local $1)
-         )
-        )
-        (tee_local $4
-         (i32.load
-          (get_local $1)
-         )
-        )
-       )
-      )
-     )
-    )
-    (call $_ZNSt3__16vectorIcNS_9allocatorIcEEE8__appendEj
-     (get_local $1)
-     (i32.sub
-      (get_local $3)
-      (get_local $2)
-     )
-    )
-    (set_local $5
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load
-      (i32.add
-       (get_local $1)
-       (i32.const 4)
-      )
-     )
-    )
-    (set_local $4
-     (i32.load
-      (get_local $1)
-     )
-    )
-    (br $label$1)
-   )
-   (br_if $label$1
-    (i32.ge_u
-     (get_local $3)
-     (get_local $2)
-    )
-   )
-   (i32.store
-    (i32.add
-     (get_local $1)
-     (i32.const 4)
-    )
-    (tee_local $7
-     (i32.add
-      (get_local $4)
-      (get_local $3)
-     )
-    )
-   )
-  )
-  (call $eosio_assert
-   (i32.ge_u
-    (i32.sub
-     (i32.load
-      (i32.add
-       (get_local $0)
-       (i32.const 8)
-      )
-     )
-     (get_local $5)
-    )
-    (tee_local $5
-     (i32.sub
-      (get_local $7)
-      (get_local $4)
-     )
-    )
-   )
-   (i32.const 480)
-  )
-  (drop
-   (call $memcpy
-    (get_local $4)
-    (i32.load
-     (tee_local $7
-      (i32.add
-       (get_local $0)
-       (i32.const 4)
-      )
-     )
-    )
-    (get_local $5)
-   )
-  )
-  (i32.store
-   (get_local $7)
-   (i32.add
-    (i32.load
-     (get_local $7)
-    )
-    (get_local $5)
-   )
-  )
-  (get_local $0)
- )
- (func $_ZNSt3__16vectorIcNS_9allocatorIcEEE8__appendEj (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (block $label$4
-       (br_if $label$4
-        (i32.ge_u
-         (i32.sub
-          (tee_local $2
-           (i32.load offset=8
-            (get_local $0)
-           )
-          )
-          (tee_local $6
-           (i32.load offset=4
-            (get_local $0)
-           )
-          )
-         )
-         (get_local $1)
-        )
-       )
-       (br_if $label$2
-        (i32.le_s
-         (tee_local $4
-          (i32.add
-           (tee_local $3
-            (i32.sub
-             (get_local $6)
-             (tee_local $5
-              (i32.load
-               (get_local $0)
-              )
-             )
-            )
-           )
-           (get_local $1)
-          )
-         )
-         (i32.const -1)
-        )
-       )
-       (set_local $6
-        (i32.const 2147483647)
-       )
-       (block $label$5
-        (br_if $label$5
-         (i32.gt_u
-          (tee_local $2
-           (i32.sub
-            (get_local $2)
-            (get_local $5)
-           )
-          )
-          (i32.const 1073741822)
-         )
-        )
-        (br_if $label$3
-         (i32.eqz
-          (tee_local $6
-           (select
-            (get_local $4)
-            (tee_local $6
-             (i32.shl
-              (get_local $2)
-              (i32.const 1)
-             )
-            )
-            (i32.lt_u
-             (get_local $6)
-             (get_local $4)
-            )
-           )
-          )
-         )
-        )
-       )
-       (set_local $2
-        (call $_Znwj
-         (get_local $6)
-        )
-       )
-       (br $label$1)
-      )
-      (set_local $0
-       (i32.add
-        (get_local $0)
-        (i32.const 4)
-       )
-      )
-      (loop $label$6
-       (i32.store8
-        (get_local $6)
-        (i32.const 0)
-       )
-       (i32.store
-        (get_local $0)
-        (tee_local $6
-         (i32.add
-          (i32.load
-           (get_local $0)
-          )
-          (i32.const 1)
-         )
-        )
-       )
-       (br_if $label$6
-        (tee_local $1
-         (i32.add
-          (get_local $1)
-          (i32.const -1)
-         )
-        )
-       )
-       (br $label$0)
-      )
-     )
-     (set_local $6
-      (i32.const 0)
-     )
-     (set_local $2
-      (i32.const 0)
-     )
-     (br $label$1)
-    )
-    (call $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv
-     (get_local $0)
-    )
-    (unreachable)
-   )
-   (set_local $4
-    (i32.add
-     (get_local $2)
-     (get_local $6)
-    )
-   )
-   (set_local $6
-    (tee_local $5
-     (i32.add
-      (get_local $2)
-      (get_local $3)
-     )
-    )
-   )
-   (loop $label$7
-    (i32.store8
-     (get_local $6)
-     (i32.const 0)
-    )
-    (set_local $6
-     (i32.add
-      (get_local $6)
-      (i32.const 1)
-     )
-    )
-    (br_if $label$7
-     (tee_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const -1)
-      )
-     )
-    )
-   )
-   (set_local $5
-    (i32.sub
-     (get_local $5)
-     (tee_local $2
-      (i32.sub
-       (i32.load
-        (tee_local $3
-         (i32.add
-          (get_local $0)
-          (i32.const 4)
-         )
-        )
-       )
-       (tee_local $1
-        (i32.load
-         (get_local $0)
-        )
-       )
-      )
-     )
-    )
-   )
-   (block $label$8
-    (br_if $label$8
-     (i32.lt_s
-      (get_local $2)
-      (i32.const 1)
-     )
-    )
-    (drop
-     (call $memcpy
-      (get_local $5)
-      (get_local $1)
-      (get_local $2)
-     )
-    )
-    (set_local $1
-     (i32.load
-      (get_local $0)
-     )
-    )
-   )
-   (i32.store
-    (get_local $0)
-    (get_local $5)
-   )
-   (i32.store
-    (get_local $3)
-    (get_local $6)
-   )
-   (i32.store
-    (i32.add
-     (get_local $0)
-     (i32.const 8)
-    )
-    (get_local $4)
-   )
-   (br_if $label$0
-    (i32.eqz
-     (get_local $1)
-    )
-   )
-   (call $_ZdlPv
-    (get_local $1)
-   )
-   (return)
-  )
- )
- (func $_ZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE6modifyIZNS2_8validateEyE3$_2EEvRKS3_yOT_ (param $0 i32) (param $1 i32) (param $2 i64)
-  (local $3 i64)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (local $9 i32)
-  (set_local $9
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $8)
-  )
-  (call $eosio_assert
-   (i32.eq
-    (i32.load offset=24
-     (get_local $1)
-    )
-    (get_local $0)
-   )
-   (i32.const 256)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (i64.load
-     (get_local $0)
-    )
-    (call $current_receiver)
-   )
-   (i32.const 304)
-  )
-  (i32.store8 offset=20
-   (get_local $1)
-   (i32.const 1)
-  )
-  (set_local $3
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (call $eosio_assert
-   (i32.const 1)
-   (i32.const 368)
-  )
-  (set_local $6
-   (i32.add
-    (tee_local $5
-     (select
-      (i32.load
-       (i32.add
-        (get_local $1)
-        (i32.const 12)
-       )
-      )
-      (i32.shr_u
-       (tee_local $6
-        (i32.load8_u offset=8
-         (get_local $1)
-        )
-       )
-       (i32.const 1)
-      )
-      (i32.and
-       (get_local $6)
-       (i32.const 1)
-      )
-     )
-    )
-    (i32.const 9)
-   )
-  )
-  (set_local $7
-   (i64.extend_u/i32
-    (get_local $5)
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (set_local $4
-   (i32.add
-    (get_local $1)
-    (i32.const 20)
-   )
-  )
-  (loop $label$0
-   (set_local $6
-    (i32.add
-     (get_local $6)
-     (i32.const 1)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $7
-      (i64.shr_u
-       (get_local $7)
-       (i64.const 7)
-      )
-     )
-     (i64.const 0)
-    )
-   )
-  )
-  (block $label$1
-   (block $label$2
-    (br_if $label$2
-     (i32.lt_u
-      (get_local $6)
-      (i32.const 513)
-     )
-    )
-    (set_local $8
-     (call $malloc
-      (get_local $6)
-     )
-    )
-    (br $label$1)
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (tee_local $8
-     (i32.sub
-      (get_local $8)
-      (i32.and
-       (i32.add
-        (get_local $6)
-        (i32.const 15)
-       )
-       (i32.const -16)
-      )
-     )
-    )
-   )
-  )
-  (i32.store
-   (get_local $9)
-   (get_local $8)
-  )
-  (i32.store offset=8
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (get_local $6)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (get_local $6)
-    (i32.const 7)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (get_local $8)
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $5
-       (call $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE
-        (get_local $9)
-        (get_local $5)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $5)
-     )
-    )
-    (i32.const 0)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $5)
-    )
-    (get_local $4)
-    (i32.const 1)
-   )
-  )
-  (i32.store offset=4
-   (get_local $5)
-   (i32.add
-    (i32.load offset=4
-     (get_local $5)
-    )
-    (i32.const 1)
-   )
-  )
-  (call $db_update_i64
-   (i32.load offset=28
-    (get_local $1)
-   )
-   (get_local $2)
-   (get_local $8)
-   (get_local $6)
-  )
-  (block $label$3
-   (br_if $label$3
-    (i32.lt_u
-     (get_local $6)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $8)
-   )
-  )
-  (block $label$4
-   (br_if $label$4
-    (i64.lt_u
-     (get_local $3)
-     (i64.load offset=16
-      (get_local $0)
-     )
-    )
-   )
-   (i64.store
-    (i32.add
-     (get_local $0)
-     (i32.const 16)
-    )
-    (select
-     (i64.const -2)
-     (i64.add
-      (get_local $3)
-      (i64.const 1)
-     )
-     (i64.gt_u
-      (get_local $3)
-      (i64.const -3)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 16)
-   )
-  )
- )
- (func $_ZN5boost4mp116detail16tuple_apply_implIRZN5eosio14execute_actionIN21UnificationFoundation18unification_motherES6_JyNSt3__112basic_stringIcNS7_11char_traitsIcEENS7_9allocatorIcEEEEEEEbPT_MT0_FvDpT1_EEUlDpT_E_RNS7_5tupleIJySD_EEEJLj0ELj1EEEEDTclclsr3stdE7forwardISE_Efp_Espclsr3stdE3getIXT1_EEclsr3stdE7forwardISG_Efp0_EEEEOSE_OSG_NS0_16integer_sequenceIjJXspT1_EEEE (param $0 i32) (param $1 i32)
-  (local $2 i64)
-  (local $3 i32)
-  (local $4 i32)
-  (i32.store offset=4
-   (i32.const 0)
-   (tee_local $4
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 32)
-    )
-   )
-  )
-  (set_local $2
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-    (get_local $4)
-    (i32.add
-     (get_local $1)
-     (i32.const 8)
-    )
-   )
-  )
-  (set_local $1
-   (i32.add
-    (i32.load
-     (i32.load
-      (get_local $0)
-     )
-    )
-    (i32.shr_s
-     (tee_local $3
-      (i32.load offset=4
-       (tee_local $0
-        (i32.load offset=4
-         (get_local $0)
-        )
-       )
-      )
-     )
-     (i32.const 1)
-    )
-   )
-  )
-  (set_local $0
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (i32.and
-      (get_local $3)
-      (i32.const 1)
-     )
-    )
-   )
-   (set_local $0
-    (i32.load
-     (i32.add
-      (i32.load
-       (get_local $1)
-      )
-      (get_local $0)
-     )
-    )
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_
-    (i32.add
-     (get_local $4)
-     (i32.const 16)
-    )
-    (get_local $4)
-   )
-  )
-  (call_indirect (type $FUNCSIG$viji)
-   (get_local $1)
-   (get_local $2)
-   (i32.add
-    (get_local $4)
-    (i32.const 16)
-   )
-   (get_local $0)
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.eqz
-     (i32.and
-      (i32.load8_u offset=16
-       (get_local $4)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load offset=24
-     (get_local $4)
-    )
-   )
-  )
-  (block $label$2
-   (br_if $label$2
-    (i32.eqz
-     (i32.and
-      (i32.load8_u
-       (get_local $4)
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (call $_ZdlPv
-    (i32.load offset=8
-     (get_local $4)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $4)
-    (i32.const 32)
-   )
-  )
- )
- (func $_ZZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE7emplaceIZNS2_6addnewEyNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEE3$_0EENS4_14const_iteratorEyOT_ENKUlRSF_E_clINS4_4itemEEEDaSH_ (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i64)
-  (local $7 i32)
-  (local $8 i32)
-  (set_local $8
-   (tee_local $7
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $7)
-  )
-  (i64.store
-   (get_local $1)
-   (i64.load
-    (i32.load
-     (tee_local $5
-      (i32.load offset=4
-       (get_local $0)
-      )
-     )
-    )
-   )
-  )
-  (set_local $2
-   (i32.load
-    (get_local $0)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEaSERKS5_
-    (tee_local $4
-     (i32.add
-      (get_local $1)
-      (i32.const 8)
-     )
-    )
-    (i32.load offset=4
-     (get_local $5)
-    )
-   )
-  )
-  (i32.store8 offset=20
-   (get_local $1)
-   (i32.const 1)
-  )
-  (set_local $5
-   (i32.add
-    (tee_local $3
-     (select
-      (i32.load
-       (i32.add
-        (get_local $1)
-        (i32.const 12)
-       )
-      )
-      (i32.shr_u
-       (tee_local $5
-        (i32.load8_u offset=8
-         (get_local $1)
-        )
-       )
-       (i32.const 1)
-      )
-      (i32.and
-       (get_local $5)
-       (i32.const 1)
-      )
-     )
-    )
-    (i32.const 9)
-   )
-  )
-  (set_local $6
-   (i64.extend_u/i32
-    (get_local $3)
-   )
-  )
-  (set_local $3
-   (i32.add
-    (get_local $1)
-    (i32.const 20)
-   )
-  )
-  (loop $label$0
-   (set_local $5
-    (i32.add
-     (get_local $5)
-     (i32.const 1)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $6
-      (i64.shr_u
-       (get_local $6)
-       (i64.const 7)
-      )
-     )
-     (i64.const 0)
-    )
-   )
-  )
-  (block $label$1
-   (block $label$2
-    (br_if $label$2
-     (i32.lt_u
-      (get_local $5)
-      (i32.const 513)
-     )
-    )
-    (set_local $7
-     (call $malloc
-      (get_local $5)
-     )
-    )
-    (br $label$1)
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (tee_local $7
-     (i32.sub
-      (get_local $7)
-      (i32.and
-       (i32.add
-        (get_local $5)
-        (i32.const 15)
-       )
-       (i32.const -16)
-      )
-     )
-    )
-   )
-  )
-  (i32.store
-   (get_local $8)
-   (get_local $7)
-  )
-  (i32.store offset=8
-   (get_local $8)
-   (i32.add
-    (get_local $7)
-    (get_local $5)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (get_local $5)
-    (i32.const 7)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (get_local $7)
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $8)
-   (i32.add
-    (get_local $7)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $4
-       (call $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE
-        (get_local $8)
-        (get_local $4)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $4)
-     )
-    )
-    (i32.const 0)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $4)
-    )
-    (get_local $3)
-    (i32.const 1)
-   )
-  )
-  (i32.store offset=4
-   (get_local $4)
-   (i32.add
-    (i32.load offset=4
-     (get_local $4)
-    )
-    (i32.const 1)
-   )
-  )
-  (i32.store offset=28
-   (get_local $1)
-   (call $db_store_i64
-    (i64.load offset=8
-     (get_local $2)
-    )
-    (i64.const -2764395868126707712)
-    (i64.load
-     (i32.load offset=8
-      (get_local $0)
-     )
-    )
-    (tee_local $6
-     (i64.load
-      (get_local $1)
-     )
-    )
-    (get_local $7)
-    (get_local $5)
-   )
-  )
-  (block $label$3
-   (br_if $label$3
-    (i32.lt_u
-     (get_local $5)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $7)
-   )
-  )
-  (block $label$4
-   (br_if $label$4
-    (i64.lt_u
-     (get_local $6)
-     (i64.load offset=16
-      (get_local $2)
-     )
-    )
-   )
-   (i64.store
-    (i32.add
-     (get_local $2)
-     (i32.const 16)
-    )
-    (select
-     (i64.const -2)
-     (i64.add
-      (get_local $6)
-      (i64.const 1)
-     )
-     (i64.gt_u
-      (get_local $6)
-      (i64.const -3)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $8)
-    (i32.const 16)
-   )
-  )
- )
- (func $_ZN5eosio11multi_indexILy15682348205582843904EN21UnificationFoundation18unification_mother9validappsEJEE6modifyIZNS2_6addnewEyNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEEE3$_1EEvRKS3_yOT_ (param $0 i32) (param $1 i32) (param $2 i64) (param $3 i32)
-  (local $4 i64)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i64)
-  (local $8 i32)
-  (local $9 i32)
-  (set_local $9
-   (tee_local $8
-    (i32.sub
-     (i32.load offset=4
-      (i32.const 0)
-     )
-     (i32.const 16)
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (get_local $8)
-  )
-  (call $eosio_assert
-   (i32.eq
-    (i32.load offset=24
-     (get_local $1)
-    )
-    (get_local $0)
-   )
-   (i32.const 256)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (i64.load
-     (get_local $0)
-    )
-    (call $current_receiver)
-   )
-   (i32.const 304)
-  )
-  (set_local $4
-   (i64.load
-    (get_local $1)
-   )
-  )
-  (drop
-   (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEaSERKS5_
-    (tee_local $6
-     (i32.add
-      (get_local $1)
-      (i32.const 8)
-     )
-    )
-    (i32.load
-     (get_local $3)
-    )
-   )
-  )
-  (i32.store8 offset=20
-   (get_local $1)
-   (i32.const 1)
-  )
-  (call $eosio_assert
-   (i64.eq
-    (get_local $4)
-    (i64.load
-     (get_local $1)
-    )
-   )
-   (i32.const 368)
-  )
-  (set_local $3
-   (i32.add
-    (tee_local $5
-     (select
-      (i32.load
-       (i32.add
-        (get_local $1)
-        (i32.const 12)
-       )
-      )
-      (i32.shr_u
-       (tee_local $3
-        (i32.load8_u offset=8
-         (get_local $1)
-        )
-       )
-       (i32.const 1)
-      )
-      (i32.and
-       (get_local $3)
-       (i32.const 1)
-      )
-     )
-    )
-    (i32.const 9)
-   )
-  )
-  (set_local $7
-   (i64.extend_u/i32
-    (get_local $5)
-   )
-  )
-  (set_local $5
-   (i32.add
-    (get_local $1)
-    (i32.const 20)
-   )
-  )
-  (loop $label$0
-   (set_local $3
-    (i32.add
-     (get_local $3)
-     (i32.const 1)
-    )
-   )
-   (br_if $label$0
-    (i64.ne
-     (tee_local $7
-      (i64.shr_u
-       (get_local $7)
-       (i64.const 7)
-      )
-     )
-     (i64.const 0)
-    )
-   )
-  )
-  (block $label$1
-   (block $label$2
-    (br_if $label$2
-     (i32.lt_u
-      (get_local $3)
-      (i32.const 513)
-     )
-    )
-    (set_local $8
-     (call $malloc
-      (get_local $3)
-     )
-    )
-    (br $label$1)
-   )
-   (i32.store offset=4
-    (i32.const 0)
-    (tee_local $8
-     (i32.sub
-      (get_local $8)
-      (i32.and
-       (i32.add
-        (get_local $3)
-        (i32.const 15)
-       )
-       (i32.const -16)
-      )
-     )
-    )
-   )
-  )
-  (i32.store
-   (get_local $9)
-   (get_local $8)
-  )
-  (i32.store offset=8
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (get_local $3)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (get_local $3)
-    (i32.const 7)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (get_local $8)
-    (get_local $1)
-    (i32.const 8)
-   )
-  )
-  (i32.store offset=4
-   (get_local $9)
-   (i32.add
-    (get_local $8)
-    (i32.const 8)
-   )
-  )
-  (call $eosio_assert
-   (i32.gt_s
-    (i32.sub
-     (i32.load offset=8
-      (tee_local $6
-       (call $_ZN5eosiolsINS_10datastreamIPcEEEERT_S5_RKNSt3__112basic_stringIcNS6_11char_traitsIcEENS6_9allocatorIcEEEE
-        (get_local $9)
-        (get_local $6)
-       )
-      )
-     )
-     (i32.load offset=4
-      (get_local $6)
-     )
-    )
-    (i32.const 0)
-   )
-   (i32.const 432)
-  )
-  (drop
-   (call $memcpy
-    (i32.load offset=4
-     (get_local $6)
-    )
-    (get_local $5)
-    (i32.const 1)
-   )
-  )
-  (i32.store offset=4
-   (get_local $6)
-   (i32.add
-    (i32.load offset=4
-     (get_local $6)
-    )
-    (i32.const 1)
-   )
-  )
-  (call $db_update_i64
-   (i32.load offset=28
-    (get_local $1)
-   )
-   (get_local $2)
-   (get_local $8)
-   (get_local $3)
-  )
-  (block $label$3
-   (br_if $label$3
-    (i32.lt_u
-     (get_local $3)
-     (i32.const 513)
-    )
-   )
-   (call $free
-    (get_local $8)
-   )
-  )
-  (block $label$4
-   (br_if $label$4
-    (i64.lt_u
-     (get_local $4)
-     (i64.load offset=16
-      (get_local $0)
-     )
-    )
-   )
-   (i64.store
-    (i32.add
-     (get_local $0)
-     (i32.const 16)
-    )
-    (select
-     (i64.const -2)
-     (i64.add
-      (get_local $4)
-      (i64.const 1)
-     )
-     (i64.gt_u
-      (get_local $4)
-      (i64.const -3)
-     )
-    )
-   )
-  )
-  (i32.store offset=4
-   (i32.const 0)
-   (i32.add
-    (get_local $9)
-    (i32.const 16)
-   )
-  )
- )
- (func $_ZN21UnificationFoundation18unification_motherC2Ey (param $0 i32) (param $1 i64) (result i32)
-  (i64.store
-   (get_local $0)
-   (get_local $1)
-  )
-  (get_local $0)
- )
- (func $malloc (param $0 i32) (result i32)
-  (call $_ZN5eosio14memory_manager6mallocEm
-   (i32.const 596)
-   (get_local $0)
-  )
- )
- (func $_ZN5eosio14memory_manager6mallocEm (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (local $10 i32)
-  (local $11 i32)
-  (local $12 i32)
-  (local $13 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (get_local $1)
-    )
-   )
-   (block $label$1
-    (br_if $label$1
-     (tee_local $13
-      (i32.load offset=8384
-       (get_local $0)
-      )
-     )
-    )
-    (set_local $13
-     (i32.const 16)
-    )
-    (i32.store
-     (i32.add
-      (get_local $0)
-      (i32.const 8384)
-     )
-     (i32.const 16)
-    )
-   )
-   (set_local $2
-    (select
-     (i32.sub
-      (i32.add
-       (get_local $1)
-       (i32.const 8)
-      )
-      (tee_local $2
-       (i32.and
-        (i32.add
-         (get_local $1)
-         (i32.const 4)
-        )
-        (i32.const 7)
-       )
-      )
-     )
-     (get_local $1)
-     (get_local $2)
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (block $label$4
-      (br_if $label$4
-       (i32.ge_u
-        (tee_local $10
-         (i32.load offset=8388
-          (get_local $0)
-         )
-        )
-        (get_local $13)
-       )
-      )
-      (set_local $1
-       (i32.add
-        (i32.add
-         (get_local $0)
-         (i32.mul
-          (get_local $10)
-          (i32.const 12)
-         )
-        )
-        (i32.const 8192)
-       )
-      )
-      (block $label$5
-       (br_if $label$5
-        (get_local $10)
-       )
-       (br_if $label$5
-        (i32.load
-         (tee_local $13
-          (i32.add
-           (get_local $0)
-           (i32.const 8196)
-          )
-         )
-        )
-       )
-       (i32.store
-        (get_local $1)
-        (i32.const 8192)
-       )
-       (i32.store
-        (get_local $13)
-        (get_local $0)
-       )
-      )
-      (set_local $10
-       (i32.add
-        (get_local $2)
-        (i32.const 4)
-       )
-      )
-      (loop $label$6
-       (block $label$7
-        (br_if $label$7
-         (i32.gt_u
-          (i32.add
-           (tee_local $13
-            (i32.load offset=8
-             (get_local $1)
-            )
-           )
-           (get_local $10)
-          )
-          (i32.load
-           (get_local $1)
-          )
-         )
-        )
-        (i32.store
-         (tee_local $13
-          (i32.add
-           (i32.load offset=4
-            (get_local $1)
-           )
-           (get_local $13)
-          )
-         )
-         (i32.or
-          (i32.and
-           (i32.load
-            (get_local $13)
-           )
-           (i32.const -2147483648)
-          )
-          (get_local $2)
-         )
-        )
-        (i32.store
-         (tee_local $1
-          (i32.add
-           (get_local $1)
-           (i32.const 8)
-          )
-         )
-         (i32.add
-          (i32.load
-           (get_local $1)
-          )
-          (get_local $10)
-         )
-        )
-        (i32.store
-         (get_local $13)
-         (i32.or
-          (i32.load
-           (get_local $13)
-          )
-          (i32.const -2147483648)
-         )
-        )
-        (br_if $label$3
-         (tee_local $1
-          (i32.add
-           (get_local $13)
-           (i32.const 4)
-          )
-         )
-        )
-       )
-       (br_if $label$6
-        (tee_local $1
-         (call $_ZN5eosio14memory_manager16next_active_heapEv
-          (get_local $0)
-         )
-        )
-       )
-      )
-     )
-     (set_local $4
-      (i32.sub
-       (i32.const 2147483644)
-       (get_local $2)
-      )
-     )
-     (set_local $11
-      (i32.add
-       (get_local $0)
-       (i32.const 8392)
-      )
-     )
-     (set_local $12
-      (i32.add
-       (get_local $0)
-       (i32.const 8384)
-      )
-     )
-     (set_local $13
-      (tee_local $3
-       (i32.load offset=8392
-        (get_local $0)
-       )
-      )
-     )
-     (loop $label$8
-      (call $eosio_assert
-       (i32.eq
-        (i32.load
-         (i32.add
-          (tee_local $1
-           (i32.add
-            (get_local $0)
-            (i32.mul
-             (get_local $13)
-             (i32.const 12)
-            )
-           )
-          )
-          (i32.const 8200)
-         )
-        )
-        (i32.load
-         (tee_local $5
-          (i32.add
-           (get_local $1)
-           (i32.const 8192)
-          )
-         )
-        )
-       )
-       (i32.const 8992)
-      )
-      (set_local $13
-       (i32.add
-        (tee_local $6
-         (i32.load
-          (i32.add
-           (get_local $1)
-           (i32.const 8196)
-          )
-         )
-        )
-        (i32.const 4)
-       )
-      )
-      (loop $label$9
-       (set_local $7
-        (i32.add
-         (get_local $6)
-         (i32.load
-          (get_local $5)
-         )
-        )
-       )
-       (set_local $1
-        (i32.and
-         (tee_local $9
-          (i32.load
-           (tee_local $8
-            (i32.add
-             (get_local $13)
-             (i32.const -4)
-            )
-           )
-          )
-         )
-         (i32.const 2147483647)
-        )
-       )
-       (block $label$10
-        (br_if $label$10
-         (i32.lt_s
-          (get_local $9)
-          (i32.const 0)
-         )
-        )
-        (block $label$11
-         (br_if $label$11
-          (i32.ge_u
-           (get_local $1)
-           (get_local $2)
-          )
-         )
-         (loop $label$12
-          (br_if $label$11
-           (i32.ge_u
-            (tee_local $10
-             (i32.add
-              (get_local $13)
-              (get_local $1)
-             )
-            )
-            (get_local $7)
-           )
-          )
-          (br_if $label$11
-           (i32.lt_s
-            (tee_local $10
-             (i32.load
-              (get_local $10)
-             )
-            )
-            (i32.const 0)
-           )
-          )
-          (br_if $label$12
-           (i32.lt_u
-            (tee_local $1
-             (i32.add
-              (i32.add
-               (get_local $1)
-               (i32.and
-                (get_local $10)
-                (i32.const 2147483647)
-               )
-              )
-              (i32.const 4)
-             )
-            )
-            (get_local $2)
-           )
-          )
-         )
-        )
-        (i32.store
-         (get_local $8)
-         (i32.or
-          (select
-           (get_local $1)
-           (get_local $2)
-           (i32.lt_u
-            (get_local $1)
-            (get_local $2)
-           )
-          )
-          (i32.and
-           (get_local $9)
-           (i32.const -2147483648)
-          )
-         )
-        )
-        (block $label$13
-         (br_if $label$13
-          (i32.le_u
-           (get_local $1)
-           (get_local $2)
-          )
-         )
-         (i32.store
-          (i32.add
-           (get_local $13)
-           (get_local $2)
-          )
-          (i32.and
-           (i32.add
-            (get_local $4)
-            (get_local $1)
-           )
-           (i32.const 2147483647)
-          )
-         )
-        )
-        (br_if $label$2
-         (i32.ge_u
-          (get_local $1)
-          (get_local $2)
-         )
-        )
-       )
-       (br_if $label$9
-        (i32.lt_u
-         (tee_local $13
-          (i32.add
-           (i32.add
-            (get_local $13)
-            (get_local $1)
-           )
-           (i32.const 4)
-          )
-         )
-         (get_local $7)
-        )
-       )
-      )
-      (set_local $1
-       (i32.const 0)
-      )
-      (i32.store
-       (get_local $11)
-       (tee_local $13
-        (select
-         (i32.const 0)
-         (tee_local $13
-          (i32.add
-           (i32.load
-            (get_local $11)
-           )
-           (i32.const 1)
-          )
-         )
-         (i32.eq
-          (get_local $13)
-          (i32.load
-           (get_local $12)
-          )
-         )
-        )
-       )
-      )
-      (br_if $label$8
-       (i32.ne
-        (get_local $13)
-        (get_local $3)
-       )
-      )
-     )
-    )
-    (return
-     (get_local $1)
-    )
-   )
-   (i32.store
-    (get_local $8)
-    (i32.or
-     (i32.load
-      (get_local $8)
-     )
-     (i32.const -2147483648)
-    )
-   )
-   (return
-    (get_local $13)
-   )
-  )
-  (i32.const 0)
- )
- (func $_ZN5eosio14memory_manager16next_active_heapEv (param $0 i32) (result i32)
-  (local $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (local $8 i32)
-  (set_local $1
-   (i32.load offset=8388
-    (get_local $0)
-   )
-  )
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (i32.load8_u offset=9078
-       (i32.const 0)
-      )
-     )
-    )
-    (set_local $7
-     (i32.load offset=9080
-      (i32.const 0)
-     )
-    )
-    (br $label$0)
-   )
-   (set_local $7
-    (current_memory)
-   )
-   (i32.store8 offset=9078
-    (i32.const 0)
-    (i32.const 1)
-   )
-   (i32.store offset=9080
-    (i32.const 0)
-    (tee_local $7
-     (i32.shl
-      (get_local $7)
-      (i32.const 16)
-     )
-    )
-   )
-  )
-  (set_local $3
-   (get_local $7)
-  )
-  (block $label$2
-   (block $label$3
-    (block $label$4
-     (block $label$5
-      (br_if $label$5
-       (i32.le_u
-        (tee_local $2
-         (i32.shr_u
-          (i32.add
-           (get_local $7)
-           (i32.const 65535)
-          )
-          (i32.const 16)
-         )
-        )
-        (tee_local $8
-         (current_memory)
-        )
-       )
-      )
-      (drop
-       (grow_memory
-        (i32.sub
-         (get_local $2)
-         (get_local $8)
-        )
-       )
-      )
-      (set_local $8
-       (i32.const 0)
-      )
-      (br_if $label$4
-       (i32.ne
-        (get_local $2)
-        (current_memory)
-       )
-      )
-      (set_local $3
-       (i32.load offset=9080
-        (i32.const 0)
-       )
-      )
-     )
-     (set_local $8
-      (i32.const 0)
-     )
-     (i32.store offset=9080
-      (i32.const 0)
-      (get_local $3)
-     )
-     (br_if $label$4
-      (i32.lt_s
-       (get_local $7)
-       (i32.const 0)
-      )
-     )
-     (set_local $2
-      (i32.add
-       (get_local $0)
-       (i32.mul
-        (get_local $1)
-        (i32.const 12)
-       )
-      )
-     )
-     (set_local $7
-      (i32.sub
-       (i32.sub
-        (i32.add
-         (get_local $7)
-         (select
-          (i32.const 65536)
-          (i32.const 131072)
-          (tee_local $6
-           (i32.lt_u
-            (tee_local $8
-             (i32.and
-              (get_local $7)
-              (i32.const 65535)
-             )
-            )
-            (i32.const 64513)
-           )
-          )
-         )
-        )
-        (select
-         (get_local $8)
-         (i32.and
-          (get_local $7)
-          (i32.const 131071)
-         )
-         (get_local $6)
-        )
-       )
-       (get_local $7)
-      )
-     )
-     (block $label$6
-      (br_if $label$6
-       (i32.load8_u offset=9078
-        (i32.const 0)
-       )
-      )
-      (set_local $3
-       (current_memory)
-      )
-      (i32.store8 offset=9078
-       (i32.const 0)
-       (i32.const 1)
-      )
-      (i32.store offset=9080
-       (i32.const 0)
-       (tee_local $3
-        (i32.shl
-         (get_local $3)
-         (i32.const 16)
-        )
-       )
-      )
-     )
-     (set_local $2
-      (i32.add
-       (get_local $2)
-       (i32.const 8192)
-      )
-     )
-     (br_if $label$3
-      (i32.lt_s
-       (get_local $7)
-       (i32.const 0)
-      )
-     )
-     (set_local $6
-      (get_local $3)
-     )
-     (block $label$7
-      (br_if $label$7
-       (i32.le_u
-        (tee_local $8
-         (i32.shr_u
-          (i32.add
-           (i32.add
-            (tee_local $5
-             (i32.and
-              (i32.add
-               (get_local $7)
-               (i32.const 7)
-              )
-              (i32.const -8)
-             )
-            )
-            (get_local $3)
-           )
-           (i32.const 65535)
-          )
-          (i32.const 16)
-         )
-        )
-        (tee_local $4
-         (current_memory)
-        )
-       )
-      )
-      (drop
-       (grow_memory
-        (i32.sub
-         (get_local $8)
-         (get_local $4)
-        )
-       )
-      )
-      (br_if $label$3
-       (i32.ne
-        (get_local $8)
-        (current_memory)
-       )
-      )
-      (set_local $6
-       (i32.load offset=9080
-        (i32.const 0)
-       )
-      )
-     )
-     (i32.store offset=9080
-      (i32.const 0)
-      (i32.add
-       (get_local $6)
-       (get_local $5)
-      )
-     )
-     (br_if $label$3
-      (i32.eq
-       (get_local $3)
-       (i32.const -1)
-      )
-     )
-     (br_if $label$2
-      (i32.eq
-       (i32.add
-        (tee_local $6
-         (i32.load
-          (i32.add
-           (tee_local $1
-            (i32.add
-             (get_local $0)
-             (i32.mul
-              (get_local $1)
-              (i32.const 12)
-             )
-            )
-           )
-           (i32.const 8196)
-          )
-         )
-        )
-        (tee_local $8
-         (i32.load
-          (get_local $2)
-         )
-        )
-       )
-       (get_local $3)
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i32.eq
-        (get_local $8)
-        (tee_local $1
-         (i32.load
-          (tee_local $5
-           (i32.add
-            (get_local $1)
-            (i32.const 8200)
-           )
-          )
-         )
-        )
-       )
-      )
-      (i32.store
-       (tee_local $6
-        (i32.add
-         (get_local $6)
-         (get_local $1)
-        )
-       )
-       (i32.or
-        (i32.and
-         (i32.load
-          (get_local $6)
-         )
-         (i32.const -2147483648)
-        )
-        (i32.add
-         (i32.sub
-          (i32.const -4)
-          (get_local $1)
-         )
-         (get_local $8)
-        )
-       )
-      )
-      (i32.store
-       (get_local $5)
-       (i32.load
-        (get_local $2)
-       )
-      )
-      (i32.store
-       (get_local $6)
-       (i32.and
-        (i32.load
-         (get_local $6)
-        )
-        (i32.const 2147483647)
-       )
-      )
-     )
-     (i32.store
-      (tee_local $2
-       (i32.add
-        (get_local $0)
-        (i32.const 8388)
-       )
-      )
-      (tee_local $2
-       (i32.add
-        (i32.load
-         (get_local $2)
-        )
-        (i32.const 1)
-       )
-      )
-     )
-     (i32.store
-      (i32.add
-       (tee_local $0
-        (i32.add
-         (get_local $0)
-         (i32.mul
-          (get_local $2)
-          (i32.const 12)
-         )
-        )
-       )
-       (i32.const 8196)
-      )
-      (get_local $3)
-     )
-     (i32.store
-      (tee_local $8
-       (i32.add
-        (get_local $0)
-        (i32.const 8192)
-       )
-      )
-      (get_local $7)
-     )
-    )
-    (return
-     (get_local $8)
-    )
-   )
-   (block $label$9
-    (br_if $label$9
-     (i32.eq
-      (tee_local $8
-       (i32.load
-        (get_local $2)
-       )
-      )
-      (tee_local $7
-       (i32.load
-        (tee_local $1
-         (i32.add
-          (tee_local $3
-           (i32.add
-            (get_local $0)
-            (i32.mul
-             (get_local $1)
-             (i32.const 12)
-            )
-           )
-          )
-          (i32.const 8200)
-         )
-        )
-       )
-      )
-     )
-    )
-    (i32.store
-     (tee_local $3
-      (i32.add
-       (i32.load
-        (i32.add
-         (get_local $3)
-         (i32.const 8196)
-        )
-       )
-       (get_local $7)
-      )
-     )
-     (i32.or
-      (i32.and
-       (i32.load
-        (get_local $3)
-       )
-       (i32.const -2147483648)
-      )
-      (i32.add
-       (i32.sub
-        (i32.const -4)
-        (get_local $7)
-       )
-       (get_local $8)
-      )
-     )
-    )
-    (i32.store
-     (get_local $1)
-     (i32.load
-      (get_local $2)
-     )
-    )
-    (i32.store
-     (get_local $3)
-     (i32.and
-      (i32.load
-       (get_local $3)
-      )
-      (i32.const 2147483647)
-     )
-    )
-   )
-   (i32.store offset=8384
-    (get_local $0)
-    (tee_local $3
-     (i32.add
-      (i32.load
-       (tee_local $7
-        (i32.add
-         (get_local $0)
-         (i32.const 8388)
-        )
-       )
-      )
-      (i32.const 1)
-     )
-    )
-   )
-   (i32.store
-    (get_local $7)
-    (get_local $3)
-   )
-   (return
-    (i32.const 0)
-   )
-  )
-  (i32.store
-   (get_local $2)
-   (i32.add
-    (get_local $8)
-    (get_local $7)
-   )
-  )
-  (get_local $2)
- )
- (func $free (param $0 i32)
-  (local $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (block $label$0
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (get_local $0)
-     )
-    )
-    (br_if $label$1
-     (i32.lt_s
-      (tee_local $2
-       (i32.load offset=8980
-        (i32.const 0)
-       )
-      )
-      (i32.const 1)
-     )
-    )
-    (set_local $3
-     (i32.const 8788)
-    )
-    (set_local $1
-     (i32.add
-      (i32.mul
-       (get_local $2)
-       (i32.const 12)
-      )
-      (i32.const 8788)
-     )
-    )
-    (loop $label$2
-     (br_if $label$1
-      (i32.eqz
-       (tee_local $2
-        (i32.load
-         (i32.add
-          (get_local $3)
-          (i32.const 4)
-         )
-        )
-       )
-      )
-     )
-     (block $label$3
-      (br_if $label$3
-       (i32.gt_u
-        (i32.add
-         (get_local $2)
-         (i32.const 4)
-        )
-        (get_local $0)
-       )
-      )
-      (br_if $label$0
-       (i32.gt_u
-        (i32.add
-         (get_local $2)
-         (i32.load
-          (get_local $3)
-         )
-        )
-        (get_local $0)
-       )
-      )
-     )
-     (br_if $label$2
-      (i32.lt_u
-       (tee_local $3
-        (i32.add
-         (get_local $3)
-         (i32.const 12)
-        )
-       )
-       (get_local $1)
-      )
-     )
-    )
-   )
-   (return)
-  )
-  (i32.store
-   (tee_local $3
-    (i32.add
-     (get_local $0)
-     (i32.const -4)
-    )
-   )
-   (i32.and
-    (i32.load
-     (get_local $3)
-    )
-    (i32.const 2147483647)
-   )
-  )
- )
- (func $_Znwj (param $0 i32) (result i32)
-  (local $1 i32)
-  (local $2 i32)
-  (block $label$0
-   (br_if $label$0
-    (tee_local $0
-     (call $malloc
-      (tee_local $1
-       (select
-        (get_local $0)
-        (i32.const 1)
-        (get_local $0)
-       )
-      )
-     )
-    )
-   )
-   (loop $label$1
-    (set_local $0
-     (i32.const 0)
-    )
-    (br_if $label$0
-     (i32.eqz
-      (tee_local $2
-       (i32.load offset=9084
-        (i32.const 0)
-       )
-      )
-     )
-    )
-    (call_indirect (type $FUNCSIG$v)
-     (get_local $2)
-    )
-    (br_if $label$1
-     (i32.eqz
-      (tee_local $0
-       (call $malloc
-        (get_local $1)
-       )
-      )
-     )
-    )
-   )
-  )
-  (get_local $0)
- )
- (func $_ZdlPv (param $0 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (get_local $0)
-    )
-   )
-   (call $free
-    (get_local $0)
-   )
-  )
- )
- (func $_ZNKSt3__121__basic_string_commonILb1EE20__throw_length_errorEv (param $0 i32)
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEaSERKS5_ (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (block $label$0
-   (block $label$1
-    (block $label$2
-     (block $label$3
-      (br_if $label$3
-       (i32.eq
-        (get_local $0)
-        (get_local $1)
-       )
-      )
-      (set_local $2
-       (select
-        (i32.load offset=4
-         (get_local $1)
-        )
-        (i32.shr_u
-         (tee_local $2
-          (i32.load8_u
-           (get_local $1)
-          )
-         )
-         (i32.const 1)
-        )
-        (tee_local $4
-         (i32.and
-          (get_local $2)
-          (i32.const 1)
-         )
-        )
-       )
-      )
-      (set_local $5
-       (i32.add
-        (get_local $1)
-        (i32.const 1)
-       )
-      )
-      (set_local $6
-       (i32.load offset=8
-        (get_local $1)
-       )
-      )
-      (set_local $1
-       (i32.const 10)
-      )
-      (block $label$4
-       (br_if $label$4
-        (i32.eqz
-         (i32.and
-          (tee_local $3
-           (i32.load8_u
-            (get_local $0)
-           )
-          )
-          (i32.const 1)
-         )
-        )
-       )
-       (set_local $1
-        (i32.add
-         (i32.and
-          (tee_local $3
-           (i32.load
-            (get_local $0)
-           )
-          )
-          (i32.const -2)
-         )
-         (i32.const -1)
-        )
-       )
-      )
-      (set_local $5
-       (select
-        (get_local $6)
-        (get_local $5)
-        (get_local $4)
-       )
-      )
-      (set_local $4
-       (i32.and
-        (get_local $3)
-        (i32.const 1)
-       )
-      )
-      (block $label$5
-       (block $label$6
-        (block $label$7
-         (br_if $label$7
-          (i32.le_u
-           (get_local $2)
-           (get_local $1)
-          )
-         )
-         (br_if $label$6
-          (get_local $4)
-         )
-         (set_local $3
-          (i32.shr_u
-           (i32.and
-            (get_local $3)
-            (i32.const 254)
-           )
-           (i32.const 1)
-          )
-         )
-         (br $label$5)
-        )
-        (br_if $label$2
-         (get_local $4)
-        )
-        (set_local $1
-         (i32.add
-          (get_local $0)
-          (i32.const 1)
-         )
-        )
-        (br_if $label$1
-         (get_local $2)
-        )
-        (br $label$0)
-       )
-       (set_local $3
-        (i32.load offset=4
-         (get_local $0)
-        )
-       )
-      )
-      (call $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE21__grow_by_and_replaceEjjjjjjPKc
-       (get_local $0)
-       (get_local $1)
-       (i32.sub
-        (get_local $2)
-        (get_local $1)
-       )
-       (get_local $3)
-       (i32.const 0)
-       (get_local $3)
-       (get_local $2)
-       (get_local $5)
-      )
-     )
-     (return
-      (get_local $0)
-     )
-    )
-    (set_local $1
-     (i32.load offset=8
-      (get_local $0)
-     )
-    )
-    (br_if $label$0
-     (i32.eqz
-      (get_local $2)
-     )
-    )
-   )
-   (drop
-    (call $memmove
-     (get_local $1)
-     (get_local $5)
-     (get_local $2)
-    )
-   )
-  )
-  (i32.store8
-   (i32.add
-    (get_local $1)
-    (get_local $2)
-   )
-   (i32.const 0)
-  )
-  (block $label$8
-   (br_if $label$8
-    (i32.and
-     (i32.load8_u
-      (get_local $0)
-     )
-     (i32.const 1)
-    )
-   )
-   (i32.store8
-    (get_local $0)
-    (i32.shl
-     (get_local $2)
-     (i32.const 1)
-    )
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (i32.store offset=4
-   (get_local $0)
-   (get_local $2)
-  )
-  (get_local $0)
- )
- (func $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE21__grow_by_and_replaceEjjjjjjPKc (param $0 i32) (param $1 i32) (param $2 i32) (param $3 i32) (param $4 i32) (param $5 i32) (param $6 i32) (param $7 i32)
-  (local $8 i32)
-  (local $9 i32)
-  (local $10 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.lt_u
-     (i32.sub
-      (i32.const -18)
-      (get_local $1)
-     )
-     (get_local $2)
-    )
-   )
-   (block $label$1
-    (block $label$2
-     (br_if $label$2
-      (i32.and
-       (i32.load8_u
-        (get_local $0)
-       )
-       (i32.const 1)
-      )
-     )
-     (set_local $9
-      (i32.add
-       (get_local $0)
-       (i32.const 1)
-      )
-     )
-     (br $label$1)
-    )
-    (set_local $9
-     (i32.load offset=8
-      (get_local $0)
-     )
-    )
-   )
-   (set_local $10
-    (i32.const -17)
-   )
-   (block $label$3
-    (br_if $label$3
-     (i32.gt_u
-      (get_local $1)
-      (i32.const 2147483622)
-     )
-    )
-    (set_local $10
-     (i32.const 11)
-    )
-    (br_if $label$3
-     (i32.lt_u
-      (tee_local $2
-       (select
-        (tee_local $8
-         (i32.shl
-          (get_local $1)
-          (i32.const 1)
-         )
-        )
-        (tee_local $2
-         (i32.add
-          (get_local $2)
-          (get_local $1)
-         )
-        )
-        (i32.lt_u
-         (get_local $2)
-         (get_local $8)
-        )
-       )
-      )
-      (i32.const 11)
-     )
-    )
-    (set_local $10
-     (i32.and
-      (i32.add
-       (get_local $2)
-       (i32.const 16)
-      )
-      (i32.const -16)
-     )
-    )
-   )
-   (set_local $2
-    (call $_Znwj
-     (get_local $10)
-    )
-   )
-   (block $label$4
-    (br_if $label$4
-     (i32.eqz
-      (get_local $4)
-     )
-    )
-    (drop
-     (call $memcpy
-      (get_local $2)
-      (get_local $9)
-      (get_local $4)
-     )
-    )
-   )
-   (block $label$5
-    (br_if $label$5
-     (i32.eqz
-      (get_local $6)
-     )
-    )
-    (drop
-     (call $memcpy
-      (i32.add
-       (get_local $2)
-       (get_local $4)
-      )
-      (get_local $7)
-      (get_local $6)
-     )
-    )
-   )
-   (block $label$6
-    (br_if $label$6
-     (i32.eqz
-      (tee_local $7
-       (i32.sub
-        (tee_local $3
-         (i32.sub
-          (get_local $3)
-          (get_local $5)
-         )
-        )
-        (get_local $4)
-       )
-      )
-     )
-    )
-    (drop
-     (call $memcpy
-      (i32.add
-       (i32.add
-        (get_local $2)
-        (get_local $4)
-       )
-       (get_local $6)
-      )
-      (i32.add
-       (i32.add
-        (get_local $9)
-        (get_local $4)
-       )
-       (get_local $5)
-      )
-      (get_local $7)
-     )
-    )
-   )
-   (block $label$7
-    (br_if $label$7
-     (i32.eq
-      (get_local $1)
-      (i32.const 10)
-     )
-    )
-    (call $_ZdlPv
-     (get_local $9)
-    )
-   )
-   (i32.store offset=8
-    (get_local $0)
-    (get_local $2)
-   )
-   (i32.store
-    (get_local $0)
-    (i32.or
-     (get_local $10)
-     (i32.const 1)
-    )
-   )
-   (i32.store offset=4
-    (get_local $0)
-    (tee_local $4
-     (i32.add
-      (get_local $3)
-      (get_local $6)
-     )
-    )
-   )
-   (i32.store8
-    (i32.add
-     (get_local $2)
-     (get_local $4)
-    )
-    (i32.const 0)
-   )
-   (return)
-  )
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEE7reserveEj (param $0 i32) (param $1 i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (local $6 i32)
-  (local $7 i32)
-  (block $label$0
-   (br_if $label$0
-    (i32.ge_u
-     (get_local $1)
-     (i32.const -16)
-    )
-   )
-   (set_local $2
-    (i32.const 10)
-   )
-   (block $label$1
-    (br_if $label$1
-     (i32.eqz
-      (i32.and
-       (tee_local $5
-        (i32.load8_u
-         (get_local $0)
-        )
-       )
-       (i32.const 1)
-      )
-     )
-    )
-    (set_local $2
-     (i32.add
-      (i32.and
-       (tee_local $5
-        (i32.load
-         (get_local $0)
-        )
-       )
-       (i32.const -2)
-      )
-      (i32.const -1)
-     )
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (br_if $label$3
-      (i32.and
-       (get_local $5)
-       (i32.const 1)
-      )
-     )
-     (set_local $3
-      (i32.shr_u
-       (i32.and
-        (get_local $5)
-        (i32.const 254)
-       )
-       (i32.const 1)
-      )
-     )
-     (br $label$2)
-    )
-    (set_local $3
-     (i32.load offset=4
-      (get_local $0)
-     )
-    )
-   )
-   (set_local $4
-    (i32.const 10)
-   )
-   (block $label$4
-    (br_if $label$4
-     (i32.lt_u
-      (tee_local $1
-       (select
-        (get_local $3)
-        (get_local $1)
-        (i32.gt_u
-         (get_local $3)
-         (get_local $1)
-        )
-       )
-      )
-      (i32.const 11)
-     )
-    )
-    (set_local $4
-     (i32.add
-      (i32.and
-       (i32.add
-        (get_local $1)
-        (i32.const 16)
-       )
-       (i32.const -16)
-      )
-      (i32.const -1)
-     )
-    )
-   )
-   (block $label$5
-    (br_if $label$5
-     (i32.eq
-      (get_local $4)
-      (get_local $2)
-     )
-    )
-    (block $label$6
-     (block $label$7
-      (br_if $label$7
-       (i32.ne
-        (get_local $4)
-        (i32.const 10)
-       )
-      )
-      (set_local $6
-       (i32.const 1)
-      )
-      (set_local $1
-       (i32.add
-        (get_local $0)
-        (i32.const 1)
-       )
-      )
-      (set_local $2
-       (i32.load offset=8
-        (get_local $0)
-       )
-      )
-      (set_local $7
-       (i32.const 0)
-      )
-      (br $label$6)
-     )
-     (set_local $1
-      (call $_Znwj
-       (i32.add
-        (get_local $4)
-        (i32.const 1)
-       )
-      )
-     )
-     (block $label$8
-      (br_if $label$8
-       (i32.gt_u
-        (get_local $4)
-        (get_local $2)
-       )
-      )
-      (br_if $label$5
-       (i32.eqz
-        (get_local $1)
-       )
-      )
-     )
-     (block $label$9
-      (br_if $label$9
-       (i32.and
-        (tee_local $5
-         (i32.load8_u
-          (get_local $0)
-         )
-        )
-        (i32.const 1)
-       )
-      )
-      (set_local $7
-       (i32.const 1)
-      )
-      (set_local $2
-       (i32.add
-        (get_local $0)
-        (i32.const 1)
-       )
-      )
-      (set_local $6
-       (i32.const 0)
-      )
-      (br $label$6)
-     )
-     (set_local $2
-      (i32.load offset=8
-       (get_local $0)
-      )
-     )
-     (set_local $6
-      (i32.const 1)
-     )
-     (set_local $7
-      (i32.const 1)
-     )
-    )
-    (block $label$10
-     (block $label$11
-      (br_if $label$11
-       (i32.and
-        (get_local $5)
-        (i32.const 1)
-       )
-      )
-      (set_local $5
-       (i32.shr_u
-        (i32.and
-         (get_local $5)
-         (i32.const 254)
-        )
-        (i32.const 1)
-       )
-      )
-      (br $label$10)
-     )
-     (set_local $5
-      (i32.load offset=4
-       (get_local $0)
-      )
-     )
-    )
-    (block $label$12
-     (br_if $label$12
-      (i32.eqz
-       (tee_local $5
-        (i32.add
-         (get_local $5)
-         (i32.const 1)
-        )
-       )
-      )
-     )
-     (drop
-      (call $memcpy
-       (get_local $1)
-       (get_local $2)
-       (get_local $5)
-      )
-     )
-    )
-    (block $label$13
-     (br_if $label$13
-      (i32.eqz
-       (get_local $6)
-      )
-     )
-     (call $_ZdlPv
-      (get_local $2)
-     )
-    )
-    (block $label$14
-     (br_if $label$14
-      (i32.eqz
-       (get_local $7)
-      )
-     )
-     (i32.store offset=4
-      (get_local $0)
-      (get_local $3)
-     )
-     (i32.store offset=8
-      (get_local $0)
-      (get_local $1)
-     )
-     (i32.store
-      (get_local $0)
-      (i32.or
-       (i32.add
-        (get_local $4)
-        (i32.const 1)
-       )
-       (i32.const 1)
-      )
-     )
-     (return)
-    )
-    (i32.store8
-     (get_local $0)
-     (i32.shl
-      (get_local $3)
-      (i32.const 1)
-     )
-    )
-   )
-   (return)
-  )
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNKSt3__120__vector_base_commonILb1EE20__throw_length_errorEv (param $0 i32)
-  (call $abort)
-  (unreachable)
- )
- (func $_ZNSt3__112basic_stringIcNS_11char_traitsIcEENS_9allocatorIcEEEC2ERKS5_ (param $0 i32) (param $1 i32) (result i32)
-  (local $2 i32)
-  (local $3 i32)
-  (local $4 i32)
-  (i64.store align=4
-   (get_local $0)
-   (i64.const 0)
-  )
-  (i32.store
-   (tee_local $3
-    (i32.add
-     (get_local $0)
-     (i32.const 8)
-    )
-   )
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.and
-     (i32.load8_u
-      (get_local $1)
-     )
-     (i32.const 1)
-    )
-   )
-   (i64.store align=4
-    (get_local $0)
-    (i64.load align=4
-     (get_local $1)
-    )
-   )
-   (i32.store
-    (get_local $3)
-    (i32.load
-     (i32.add
-      (get_local $1)
-      (i32.const 8)
-     )
-    )
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (block $label$1
-   (br_if $label$1
-    (i32.ge_u
-     (tee_local $3
-      (i32.load offset=4
-       (get_local $1)
-      )
-     )
-     (i32.const -16)
-    )
-   )
-   (set_local $2
-    (i32.load offset=8
-     (get_local $1)
-    )
-   )
-   (block $label$2
-    (block $label$3
-     (block $label$4
-      (br_if $label$4
-       (i32.ge_u
-        (get_local $3)
-        (i32.const 11)
-       )
-      )
-      (i32.store8
-       (get_local $0)
-       (i32.shl
-        (get_local $3)
-        (i32.const 1)
-       )
-      )
-      (set_local $1
-       (i32.add
-        (get_local $0)
-        (i32.const 1)
-       )
-      )
-      (br_if $label$3
-       (get_local $3)
-      )
-      (br $label$2)
-     )
-     (set_local $1
-      (call $_Znwj
-       (tee_local $4
-        (i32.and
-         (i32.add
-          (get_local $3)
-          (i32.const 16)
-         )
-         (i32.const -16)
-        )
-       )
-      )
-     )
-     (i32.store
-      (get_local $0)
-      (i32.or
-       (get_local $4)
-       (i32.const 1)
-      )
-     )
-     (i32.store offset=8
-      (get_local $0)
-      (get_local $1)
-     )
-     (i32.store offset=4
-      (get_local $0)
-      (get_local $3)
-     )
-    )
-    (drop
-     (call $memcpy
-      (get_local $1)
-      (get_local $2)
-      (get_local $3)
-     )
-    )
-   )
-   (i32.store8
-    (i32.add
-     (get_local $1)
-     (get_local $3)
-    )
-    (i32.const 0)
-   )
-   (return
-    (get_local $0)
-   )
-  )
-  (call $abort)
-  (unreachable)
- )
- (func $memcmp (param $0 i32) (param $1 i32) (param $2 i32) (result i32)
-  (local $3 i32)
-  (local $4 i32)
-  (local $5 i32)
-  (set_local $5
-   (i32.const 0)
-  )
-  (block $label$0
-   (br_if $label$0
-    (i32.eqz
-     (get_local $2)
-    )
-   )
-   (block $label$1
-    (loop $label$2
-     (br_if $label$1
-      (i32.ne
-       (tee_local $3
-        (i32.load8_u
-         (get_local $0)
-        )
-       )
-       (tee_local $4
-        (i32.load8_u
-         (get_local $1)
-        )
-       )
-      )
-     )
-     (set_local $1
-      (i32.add
-       (get_local $1)
-       (i32.const 1)
-      )
-     )
-     (set_local $0
-      (i32.add
-       (get_local $0)
-       (i32.const 1)
-      )
-     )
-     (br_if $label$2
-      (tee_local $2
-       (i32.add
-        (get_local $2)
-        (i32.const -1)
-       )
-      )
-     )
-     (br $label$0)
-    )
-   )
-   (set_local $5
-    (i32.sub
-     (get_local $3)
-     (get_local $4)
-    )
-   )
-  )
-  (get_local $5)
- )
- (func $__wasm_nullptr (type $FUNCSIG$v)
-  (unreachable)
- )
-)
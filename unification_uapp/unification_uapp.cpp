@@ -21,10 +21,12 @@ namespace UnificationFoundation {
  *  Consumer data requests, and user permission information.
  */
 
-    unification_uapp::unification_uapp(action_name self) : contract(self) {}
+    unification_uapp::unification_uapp(action_name self) : contract(self), _stats(self) {}
 
     void unification_uapp::initperm(const account_name& consumer_id) {
 
+        _stats.start(N(initperm));
+
         require_auth2(consumer_id,N(modreq));
 
         userperms_t perms(_self, consumer_id);
@@ -35,11 +37,12 @@ namespace UnificationFoundation {
             //initialise ipfs_hash and merkle_root with nn byte values
             //to allow provider to update values without needing
             //consumer's auth
-            perms.emplace(consumer_id /*payer*/, [&](auto &p_rec) {
+            auto new_itr = perms.emplace(consumer_id /*payer*/, [&](auto &p_rec) {
                 p_rec.consumer_id = consumer_id;
                 p_rec.ipfs_hash = "0000000000000000000000000000000000000000000000";
                 p_rec.merkle_root = "0000000000000000000000000000000000000000000000000000000000000000";
             });
+            _stats.emplaced(*new_itr);
         }
 
     }
@@ -48,6 +51,8 @@ namespace UnificationFoundation {
                                       const std::string& ipfs_hash,
                                       const std::string& merkle_root) {
 
+        _stats.start(N(updateperm));
+
         require_auth(_self);
         userperms_t perms(_self, consumer_id);
 
@@ -59,6 +64,87 @@ namespace UnificationFoundation {
             p_rec.ipfs_hash = ipfs_hash;
             p_rec.merkle_root = merkle_root;
         });
+        _stats.modified(*itr);
+    }
+
+    void unification_uapp::grantperms(const account_name& consumer_id,
+                                      const std::vector<account_name>& users,
+                                      const uint64_t& grants) {
+        _stats.start(N(grantperms));
+
+        require_auth2(_self,N(modperms));
+
+        eosio_assert(!users.empty(), "users must not be empty");
+        eosio_assert(grants != 0, "grants must not be 0");
+
+        userperms_t perms(_self, consumer_id);
+        eosio_assert(perms.find(consumer_id) != perms.end(), "Permission relationship not found");
+
+        //each bit must refer to an existing schema, packed or not yet migrated
+        unifschemas u_schema(_self, _self);
+        unifschemas_v1 old_schema(_self, _self);
+
+        for (uint64_t n = 0; n < 64; n++) {
+            if (grants & (1ull << n)) {
+                eosio_assert(u_schema.find(n) != u_schema.end()
+                             || old_schema.find(n) != old_schema.end(), "grants includes a schema that does not exist");
+            }
+        }
+
+        usergrants_t u_grants(_self, _self);
+        auto idx = u_grants.get_index<N(byconsuser)>();
+
+        for (const auto& user_id : users) {
+            auto itr = idx.find(consumer_user_key(consumer_id, user_id));
+
+            if (itr == idx.end()) {
+                auto new_itr = u_grants.emplace(_self, [&](auto &g_rec) {
+                    g_rec.pkey = u_grants.available_primary_key();
+                    g_rec.consumer_id = consumer_id;
+                    g_rec.user_id = user_id;
+                    g_rec.grants = grants;
+                });
+                _stats.emplaced(*new_itr);
+            } else if ((itr->grants & grants) != grants) {
+                idx.modify(itr, 0 /*payer doesn't change*/, [&](auto &g_rec) {
+                    g_rec.grants |= grants;
+                });
+                _stats.modified(*itr);
+            }
+        }
+    }
+
+    void unification_uapp::revokeperms(const account_name& consumer_id,
+                                       const std::vector<account_name>& users,
+                                       const uint64_t& grants) {
+        _stats.start(N(revokeperms));
+
+        require_auth2(_self,N(modperms));
+
+        eosio_assert(!users.empty(), "users must not be empty");
+
+        usergrants_t u_grants(_self, _self);
+        auto idx = u_grants.get_index<N(byconsuser)>();
+
+        for (const auto& user_id : users) {
+            auto itr = idx.find(consumer_user_key(consumer_id, user_id));
+
+            if (itr == idx.end() || (itr->grants & grants) == 0) {
+                //nothing to revoke
+                continue;
+            }
+
+            if ((itr->grants & ~grants) == 0) {
+                //no grants left, free the RAM
+                idx.erase(itr);
+                _stats.erased();
+            } else {
+                idx.modify(itr, 0 /*payer doesn't change*/, [&](auto &g_rec) {
+                    g_rec.grants &= ~grants;
+                });
+                _stats.modified(*itr);
+            }
+        }
     }
 
     void unification_uapp::addschema(const std::string& schema,
@@ -66,6 +152,8 @@ namespace UnificationFoundation {
                                      const uint8_t& schedule,
                                      const uint8_t& price_sched,
                                      const uint8_t& price_adhoc) {
+        _stats.start(N(addschema));
+
         eosio::print("addschema()");
 
         eosio_assert((schedule == 1
@@ -78,15 +166,20 @@ namespace UnificationFoundation {
         require_auth2(_self,N(modschema));
 
         unifschemas u_schema(_self, _self);
+        unifschemas_v1 old_schema(_self, _self);
+
+        //don't reuse pkeys of rows not yet migrated
+        auto pkey = std::max(u_schema.available_primary_key(), old_schema.available_primary_key());
 
-        u_schema.emplace(_self, [&]( auto& s_rec ) {
-            s_rec.pkey = u_schema.available_primary_key();
+        auto new_itr = u_schema.emplace(_self, [&]( auto& s_rec ) {
+            s_rec.pkey = pkey;
             s_rec.schema = schema;
-            s_rec.schedule = schedule;
-            s_rec.schema_vers = 0;
+            s_rec.set_schedule(schedule);
+            s_rec.set_schema_vers(0);
             s_rec.price_sched = price_sched;
             s_rec.price_adhoc = price_adhoc;
         });
+        _stats.emplaced(*new_itr);
     }
 
     void unification_uapp::editschema(const uint64_t& pkey,
@@ -96,6 +189,8 @@ namespace UnificationFoundation {
                                       const uint8_t& price_sched,
                                       const uint8_t& price_adhoc) {
 
+        _stats.start(N(editschema));
+
         require_auth2(_self,N(modschema));
 
         eosio_assert((schedule == 1
@@ -107,22 +202,25 @@ namespace UnificationFoundation {
 
         unifschemas u_schema(_self, _self);
 
-        auto itr = u_schema.find(pkey);
+        auto itr = find_schema(u_schema, pkey);
 
         eosio_assert(itr != u_schema.end(), "Schema not found");
 
         u_schema.modify(itr, _self /*payer*/, [&](auto &s_rec) {
             s_rec.schema = schema;
-            s_rec.schedule = schedule;
-            s_rec.schema_vers = schema_vers;
+            s_rec.set_schedule(schedule);
+            s_rec.set_schema_vers(schema_vers);
             s_rec.price_sched = price_sched;
             s_rec.price_adhoc = price_adhoc;
         });
+        _stats.modified(*itr);
 
     }
 
     void unification_uapp::setvers(const uint64_t& pkey,const uint8_t& schema_vers) {
 
+        _stats.start(N(setvers));
+
         require_auth2(_self,N(modschema));
 
         eosio_assert((schema_vers == 0
@@ -130,16 +228,19 @@ namespace UnificationFoundation {
 
         unifschemas u_schema(_self, _self);
 
-        auto itr = u_schema.find(pkey);
+        auto itr = find_schema(u_schema, pkey);
 
         eosio_assert(itr != u_schema.end(), "Schema not found");
 
         u_schema.modify(itr, _self /*payer*/, [&](auto &s_rec) {
-            s_rec.schema_vers = schema_vers;
+            s_rec.set_schema_vers(schema_vers);
         });
+        _stats.modified(*itr);
     }
 
     void unification_uapp::setschedule(const uint64_t& pkey,const uint8_t& schedule) {
+        _stats.start(N(setschedule));
+
         require_auth2(_self,N(modschema));
 
         eosio_assert((schedule == 1
@@ -148,55 +249,65 @@ namespace UnificationFoundation {
 
         unifschemas u_schema(_self, _self);
 
-        auto itr = u_schema.find(pkey);
+        auto itr = find_schema(u_schema, pkey);
 
         eosio_assert(itr != u_schema.end(), "Schema not found");
 
         u_schema.modify(itr, _self /*payer*/, [&](auto &s_rec) {
-            s_rec.schedule = schedule;
+            s_rec.set_schedule(schedule);
         });
+        _stats.modified(*itr);
     }
 
     void unification_uapp::setpricesch(const uint64_t& pkey,const uint8_t& price_sched) {
+        _stats.start(N(setpricesch));
+
         require_auth2(_self,N(modschema));
 
         unifschemas u_schema(_self, _self);
 
-        auto itr = u_schema.find(pkey);
+        auto itr = find_schema(u_schema, pkey);
 
         eosio_assert(itr != u_schema.end(), "Schema not found");
 
         u_schema.modify(itr, _self /*payer*/, [&](auto &s_rec) {
             s_rec.price_sched = price_sched;
         });
+        _stats.modified(*itr);
     }
 
     void unification_uapp::setpriceadh(const uint64_t& pkey,const uint8_t& price_adhoc) {
+        _stats.start(N(setpriceadh));
+
         require_auth2(_self,N(modschema));
 
         unifschemas u_schema(_self, _self);
 
-        auto itr = u_schema.find(pkey);
+        auto itr = find_schema(u_schema, pkey);
 
         eosio_assert(itr != u_schema.end(), "Schema not found");
 
         u_schema.modify(itr, _self /*payer*/, [&](auto &s_rec) {
             s_rec.price_adhoc = price_adhoc;
         });
+        _stats.modified(*itr);
     }
 
     void unification_uapp::setschema(const uint64_t& pkey,const std::string& schema) {
+        _stats.start(N(setschema));
+
         require_auth2(_self,N(modschema));
 
         unifschemas u_schema(_self, _self);
 
-        auto itr = u_schema.find(pkey);
+        auto itr = find_schema(u_schema, pkey);
 
         eosio_assert(itr != u_schema.end(), "Schema not found");
 
         u_schema.modify(itr, _self /*payer*/, [&](auto &s_rec) {
             s_rec.schema = schema;
         });
+        _stats.modified(*itr);
     }
 
     void unification_uapp::initreq(const account_name& provider_name,
@@ -207,21 +318,34 @@ namespace UnificationFoundation {
                                    const std::string& query,
                                    const uint8_t& price) {
 
+        _stats.start(N(initreq));
+
         require_auth2(_self,N(modreq));
         //require_auth(_self);
 
+        eosio_assert((req_type == 0
+                      || req_type == 1), "req_type must 0 or 1 for scheduled, ad-hoc");
+
+        eosio_assert(ts_created <= std::numeric_limits<uint32_t>::max()
+                     && ts_updated <= std::numeric_limits<uint32_t>::max(), "timestamp out of range");
+
         unifreqs data_requests(_self, _self);
+        unifreqs_v1 old_requests(_self, _self);
 
-        data_requests.emplace(_self, [&]( auto& d_rec ) {
-            d_rec.pkey = data_requests.available_primary_key();
+        //don't reuse pkeys of rows not yet migrated
+        auto pkey = std::max(data_requests.available_primary_key(), old_requests.available_primary_key());
+
+        auto new_itr = data_requests.emplace(_self, [&]( auto& d_rec ) {
+            d_rec.pkey = pkey;
             d_rec.provider_name = provider_name;
             d_rec.schema_id = schema_id;
-            d_rec.ts_created = ts_created;
-            d_rec.ts_updated = ts_updated;
-            d_rec.req_type = req_type;
+            d_rec.ts_created = static_cast<uint32_t>(ts_created);
+            d_rec.ts_updated = static_cast<uint32_t>(ts_updated);
+            d_rec.set_req_type(req_type);
             d_rec.query = query;
             d_rec.price = price;
         });
+        _stats.emplaced(*new_itr);
 
         //Call initperm in provider's smart contract, to init required RAM for permissions storage
         action(
@@ -239,26 +363,51 @@ namespace UnificationFoundation {
                                      const uint64_t& ts_updated,
                                      const std::string& aggr) {
 
+        _stats.start(N(updatereq));
+
         require_auth2(provider_name,N(modreq));
 
         unifreqs data_requests(_self, _self);
 
-        auto itr = data_requests.find(pkey);
+        auto itr = find_req(data_requests, pkey);
+
+        if (itr == data_requests.end()) {
+            //old row that can't be packed stays in datareqs, and is updated there
+            unifreqs_v1 old_requests(_self, _self);
+
+            auto old_itr = old_requests.find(pkey);
 
-        eosio_assert(itr != data_requests.end(), "Data request not found");
+            eosio_assert(old_itr != old_requests.end(), "Data request not found");
+
+            eosio_assert(old_itr->provider_name == provider_name, "Calling account and provider_name mismatch");
+
+            old_requests.modify(old_itr, _self /*payer*/, [&](auto &d_rec) {
+                d_rec.hash = hash;
+                d_rec.aggr = aggr;
+                d_rec.ts_updated = ts_updated;
+            });
+            _stats.modified(*old_itr);
+
+            return;
+        }
 
         eosio_assert(itr->provider_name == provider_name, "Calling account and provider_name mismatch");
 
+        eosio_assert(ts_updated <= std::numeric_limits<uint32_t>::max(), "timestamp out of range");
+
         data_requests.modify(itr, _self /*payer*/, [&](auto &d_rec) {
             d_rec.hash = hash;
             d_rec.aggr = aggr;
-            d_rec.ts_updated = ts_updated;
+            d_rec.ts_updated = static_cast<uint32_t>(ts_updated);
         });
+        _stats.modified(*itr);
 
     }
 
     void unification_uapp::setrsakey(std::string rsa_key) {
 
+        _stats.start(N(setrsakey));
+
         require_auth2(_self,N(modrsakey));
 
         unifrsakey _unifrsakey(_self, _self);
@@ -266,16 +415,140 @@ namespace UnificationFoundation {
         auto itr = _unifrsakey.find(0);
 
         if(itr == _unifrsakey.end()) {
-            _unifrsakey.emplace(_self, [&]( auto& rsa_rec ) {
+            auto new_itr = _unifrsakey.emplace(_self, [&]( auto& rsa_rec ) {
                 rsa_rec.pkey = _unifrsakey.available_primary_key();
                 rsa_rec.rsa_pub_key = rsa_key;
             });
+            _stats.emplaced(*new_itr);
         } else {
             _unifrsakey.modify(itr, _self /*payer*/, [&](auto &rsa_rec) {
                 rsa_rec.rsa_pub_key = rsa_key;
             });
+            _stats.modified(*itr);
+        }
+    }
+
+    void unification_uapp::migrate(const uint32_t& max_rows, const uint64_t& start_pkey) {
+        _stats.start(N(migrate));
+
+        require_auth(_self);
+
+        //moved and skipped rows both count towards max_rows
+        uint32_t visited = 0;
+        uint32_t skipped = 0;
+
+        unifschemas_v1 old_schema(_self, _self);
+        unifschemas u_schema(_self, _self);
+
+        for (auto itr = old_schema.begin(); itr != old_schema.end() && visited < max_rows; ++visited) {
+            migrate_schema(u_schema, *itr);
+            itr = old_schema.erase(itr);
+            _stats.erased();
+        }
+
+        unifreqs_v1 old_requests(_self, _self);
+        unifreqs data_requests(_self, _self);
+
+        auto itr = old_requests.lower_bound(start_pkey);
+        for (; itr != old_requests.end() && visited < max_rows; ++visited) {
+            if (!packable(*itr)) {
+                //left in datareqs, where it can still be read and updated
+                ++itr;
+                ++skipped;
+                continue;
+            }
+
+            migrate_req(data_requests, *itr);
+            itr = old_requests.erase(itr);
+            _stats.erased();
+        }
+
+        eosio::print("migrated ", visited - skipped, " rows, skipped ", skipped, " unpackable datareqs rows");
+
+        if (itr != old_requests.end()) {
+            eosio::print(", next start_pkey ", itr->pkey);
         }
     }
 
+    unification_uapp::unifschemas::const_iterator
+    unification_uapp::find_schema(unifschemas& u_schema, const uint64_t& pkey) {
+        auto itr = u_schema.find(pkey);
+
+        if (itr == u_schema.end()) {
+            //not migrated to the packed table yet
+            unifschemas_v1 old_schema(_self, _self);
+            auto old_itr = old_schema.find(pkey);
+            if (old_itr != old_schema.end()) {
+                itr = migrate_schema(u_schema, *old_itr);
+                old_schema.erase(old_itr);
+                _stats.erased();
+            }
+        }
+
+        return itr;
+    }
+
+    unification_uapp::unifschemas::const_iterator
+    unification_uapp::migrate_schema(unifschemas& u_schema, const dataschemas& old_rec) {
+        auto new_itr = u_schema.emplace(_self, [&]( auto& s_rec ) {
+            s_rec.pkey = old_rec.pkey;
+            s_rec.schema = old_rec.schema;
+            s_rec.set_schedule(old_rec.schedule);
+            s_rec.set_schema_vers(old_rec.schema_vers);
+            s_rec.price_sched = old_rec.price_sched;
+            s_rec.price_adhoc = old_rec.price_adhoc;
+        });
+        _stats.emplaced(*new_itr);
+
+        return new_itr;
+    }
+
+    unification_uapp::unifreqs::const_iterator
+    unification_uapp::find_req(unifreqs& data_requests, const uint64_t& pkey) {
+        auto itr = data_requests.find(pkey);
+
+        if (itr == data_requests.end()) {
+            //not migrated to the packed table yet
+            unifreqs_v1 old_requests(_self, _self);
+            auto old_itr = old_requests.find(pkey);
+            if (old_itr != old_requests.end() && packable(*old_itr)) {
+                itr = migrate_req(data_requests, *old_itr);
+                old_requests.erase(old_itr);
+                _stats.erased();
+            }
+        }
+
+        return itr;
+    }
+
+    bool unification_uapp::packable(const datareqs& old_rec) {
+        return old_rec.req_type <= 1
+               && old_rec.ts_created <= std::numeric_limits<uint32_t>::max()
+               && old_rec.ts_updated <= std::numeric_limits<uint32_t>::max()
+               && old_rec.pkey <= std::numeric_limits<uint32_t>::max()
+               && old_rec.schema_id <= std::numeric_limits<uint32_t>::max();
+    }
+
+    unification_uapp::unifreqs::const_iterator
+    unification_uapp::migrate_req(unifreqs& data_requests, const datareqs& old_rec) {
+        eosio_assert(packable(old_rec), "Data request can't be packed");
+
+        auto new_itr = data_requests.emplace(_self, [&]( auto& d_rec ) {
+            d_rec.pkey = old_rec.pkey;
+            d_rec.provider_name = old_rec.provider_name;
+            d_rec.schema_id = old_rec.schema_id;
+            d_rec.ts_created = static_cast<uint32_t>(old_rec.ts_created);
+            d_rec.ts_updated = static_cast<uint32_t>(old_rec.ts_updated);
+            d_rec.set_req_type(old_rec.req_type);
+            d_rec.query = old_rec.query;
+            d_rec.price = old_rec.price;
+            d_rec.hash = old_rec.hash;
+            d_rec.aggr = old_rec.aggr;
+        });
+        _stats.emplaced(*new_itr);
+
+        return new_itr;
+    }
+
 
 }
@@ -7,6 +7,12 @@
 #include <eosiolib/contract.hpp>
 #include <eosiolib/crypto.h>
 
+#include "../common/unification_packed.hpp"
+#include "../common/unification_stats.hpp"
+
+#include <algorithm>
+#include <limits>
+
 namespace UnificationFoundation {
     using namespace eosio;
 
@@ -22,6 +28,16 @@ namespace UnificationFoundation {
                         const std::string& ipfs_hash,
                         const std::string& merkle_root);
 
+        //@abi action
+        void grantperms(const account_name& consumer_id,
+                        const std::vector<account_name>& users,
+                        const uint64_t& grants);
+
+        //@abi action
+        void revokeperms(const account_name& consumer_id,
+                         const std::vector<account_name>& users,
+                         const uint64_t& grants);
+
         //@abi action
         void addschema(const std::string& schema,
                        const uint8_t& schema_vers,
@@ -71,8 +87,13 @@ namespace UnificationFoundation {
         //@abi action
         void setrsakey(std::string rsa_key);
 
+        //@abi action
+        void migrate(const uint32_t& max_rows, const uint64_t& start_pkey);
+
     private:
 
+        stats_recorder _stats;
+
         //@abi table userperms i64
         struct userperms {
             uint64_t consumer_id;
@@ -86,6 +107,29 @@ namespace UnificationFoundation {
 
         typedef eosio::multi_index<N(userperms), userperms> userperms_t;
 
+        static uint128_t consumer_user_key(uint64_t consumer_id, uint64_t user_id) {
+            return (uint128_t{consumer_id} << 64) | user_id;
+        }
+
+        //@abi table usergrants i64
+        struct usergrants {
+            uint64_t pkey;
+            uint64_t consumer_id;
+            uint64_t user_id;
+            uint64_t grants; //bit n set = user granted consumer access to schema pkey n (pkeys 0 - 63 only)
+
+            uint64_t primary_key() const { return pkey; }
+            uint128_t by_consumer_user() const { return consumer_user_key(consumer_id, user_id); }
+
+            EOSLIB_SERIALIZE(usergrants, (pkey)(consumer_id)(user_id)(grants))
+        };
+
+        typedef eosio::multi_index<N(usergrants), usergrants,
+                indexed_by<N(byconsuser), const_mem_fun<usergrants, uint128_t, &usergrants::by_consumer_user>>
+                > usergrants_t;
+
+        //pre packed row format. Read only - rows are moved to dataschemas2 by migrate,
+        //or when first modified
         //@abi table dataschemas i64
         struct dataschemas {
             uint64_t pkey;
@@ -100,8 +144,34 @@ namespace UnificationFoundation {
             EOSLIB_SERIALIZE(dataschemas, (pkey)(schema)(schema_vers)(schedule)(price_sched)(price_adhoc))
         };
 
-        typedef eosio::multi_index<N(dataschemas), dataschemas> unifschemas;
+        typedef eosio::multi_index<N(dataschemas), dataschemas> unifschemas_v1;
+
+        //@abi table dataschemas2 i64
+        struct dataschemas2 {
+            typedef bitfield8<0, 2> schedule_bits; //1 = daily, 2 = weekly, 3 = monthly
+            typedef bitfield8<2, 1> schema_vers_bits; //0 = dev, 1 = prod
 
+            uint64_t pkey; //serialized as varuint32
+            std::string schema; //IPFS Hash etc.
+            uint8_t flags = 0; //schedule, schema_vers
+            uint8_t price_sched;
+            uint8_t price_adhoc;
+
+            uint8_t schedule() const { return schedule_bits::get(flags); }
+            uint8_t schema_vers() const { return schema_vers_bits::get(flags); }
+            void set_schedule(uint8_t schedule) { flags = schedule_bits::set(flags, schedule); }
+            void set_schema_vers(uint8_t schema_vers) { flags = schema_vers_bits::set(flags, schema_vers); }
+
+            uint64_t primary_key() const { return pkey; }
+
+            UNIF_PACKED_SERIALIZE(dataschemas2, ((pkey, as_varuint32))((schema, as_is))((flags, as_is))
+                                                ((price_sched, as_is))((price_adhoc, as_is)))
+        };
+
+        typedef eosio::multi_index<N(dataschemas2), dataschemas2> unifschemas;
+
+        //pre packed row format. Read only - rows are moved to datareqs2 by migrate,
+        //or when first modified
         //@abi table datareqs i64
         struct datareqs {
             uint64_t pkey;
@@ -120,7 +190,40 @@ namespace UnificationFoundation {
             EOSLIB_SERIALIZE(datareqs, (pkey)(provider_name)(schema_id)(ts_created)(ts_updated)(req_type)(query)(price)(hash)(aggr))
         };
 
-        typedef eosio::multi_index<N(datareqs), datareqs> unifreqs;
+        typedef eosio::multi_index<N(datareqs), datareqs> unifreqs_v1;
+
+        //@abi table datareqs2 i64
+        struct datareqs2 {
+            typedef bitfield8<0, 1> req_type_bits; //0 = scheduled, 1 = ad-hoc
+
+            uint64_t pkey; //serialized as varuint32
+            uint64_t provider_name; //account name of provider's UApp smart contract
+            uint64_t schema_id; //fkey link to provider's schema, serialized as varuint32
+            uint32_t ts_created; //Unix timestamp of when a request is made
+            uint32_t ts_updated; //Unix timestamp of when a request is updated
+            uint8_t flags = 0; //req_type
+            std::string query;
+            uint8_t price;
+            std::string hash;
+            std::string aggr;
+
+            uint8_t req_type() const { return req_type_bits::get(flags); }
+            void set_req_type(uint8_t req_type) { flags = req_type_bits::set(flags, req_type); }
+
+            uint64_t primary_key() const { return pkey; }
+
+            UNIF_PACKED_SERIALIZE(datareqs2, ((pkey, as_varuint32))((provider_name, as_is))
+                                             ((schema_id, as_varuint32))((ts_created, as_is))((ts_updated, as_is))
+                                             ((flags, as_is))((query, as_is))((price, as_is))((hash, as_is))((aggr, as_is)))
+        };
+
+        typedef eosio::multi_index<N(datareqs2), datareqs2> unifreqs;
+
+        unifschemas::const_iterator find_schema(unifschemas& u_schema, const uint64_t& pkey);
+        unifschemas::const_iterator migrate_schema(unifschemas& u_schema, const dataschemas& old_rec);
+        unifreqs::const_iterator find_req(unifreqs& data_requests, const uint64_t& pkey);
+        static bool packable(const datareqs& old_rec);
+        unifreqs::const_iterator migrate_req(unifreqs& data_requests, const datareqs& old_rec);
 
         //@abi table rsapubkey i64
         struct rsapubkey {
@@ -136,5 +239,5 @@ namespace UnificationFoundation {
 
     };
 
-    EOSIO_ABI(unification_uapp, (initperm)(updateperm)(addschema)(editschema)(setvers)(setschedule)(setpricesch)(setpriceadh)(setschema)(initreq)(updatereq)(setrsakey))
+    EOSIO_ABI(unification_uapp, (initperm)(updateperm)(grantperms)(revokeperms)(addschema)(editschema)(setvers)(setschedule)(setpricesch)(setpriceadh)(setschema)(initreq)(updatereq)(setrsakey)(migrate))
 }